@@ -0,0 +1,24 @@
+# Toolchain file for the MSP430 (TI/Mitto msp430-elf-gcc). The C99 functions
+# are used, the IAR Assembler files in src/mspasm can't be assembled by GCC.
+# MSP430_MCU selects the device, MSP430_SUPPORT_DIR the directory with the
+# device headers and linker scripts (the include directory of the toolchain).
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR msp430)
+
+set(MSP430_MCU "msp430f5438a" CACHE STRING "MSP430 device (-mmcu)")
+set(MSP430_SUPPORT_DIR "" CACHE PATH "MSP430 device support files")
+
+set(CMAKE_C_COMPILER msp430-elf-gcc)
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_C_FLAGS_INIT "-mmcu=${MSP430_MCU} -ffunction-sections -fdata-sections")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "-mmcu=${MSP430_MCU} -Wl,--gc-sections")
+if(MSP430_SUPPORT_DIR)
+  string(APPEND CMAKE_C_FLAGS_INIT " -I${MSP430_SUPPORT_DIR}")
+  string(APPEND CMAKE_EXE_LINKER_FLAGS_INIT " -L${MSP430_SUPPORT_DIR}")
+endif()
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
@@ -0,0 +1,204 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;; mon_ladder_step.s: Fused Step of the Montgomery Ladder (e.g. X25519).     ;;
+;; This file is part of SECCCM3, a Scalable ECC implementation for Cortex-M3 ;;
+;; Version 0.9.0 (15-10-26), see <http:;;github.com/johgrolux/> for updates. ;;
+;; License: GPLv3 (see LICENSE file), other licenses available upon request. ;;
+;; ------------------------------------------------------------------------- ;;
+;; This program is free software: you can redistribute it and/or modify it   ;;
+;; under the terms of the GNU General Public License as published by the     ;;
+;; Free Software Foundation, either version 3 of the License, or (at your    ;;
+;; option) any later version. This program is distributed in the hope that   ;;
+;; it will be useful, but WITHOUT ANY WARRANTY; without even the implied     ;;
+;; warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the  ;;
+;; GNU General Public License for more details. You should have received a   ;;
+;; copy of the GNU General Public License along with this program. If not,   ;;
+;; see <http:;;www.gnu.org/licenses/>.                                       ;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+
+;; void mon_ladder_step_asm(Word *xz, const Word *x, const Word *a24, Word c,
+;;                          int len);
+;;
+;; One step of the Montgomery ladder (combined differential addition and
+;; doubling). Array xz contains X2, Z2, X3, Z3 (each len words long), which
+;; are replaced by the coordinates of 2*P2 and P2+P3, x is the affine
+;; x-coordinate of P3-P2 and a24 the 32-bit constant (A+2)/4. The field
+;; operations are performed by direct calls of the gfp_*_asm functions; the
+;; pointers stay in callee-saved registers and c, len, x, and a24 in a small
+;; stack frame during the whole step.
+
+
+    AREA moncurve, CODE, READONLY
+    
+    EXPORT mon_ladder_step_asm
+    IMPORT gfp_add_asm
+    IMPORT gfp_sub_asm
+    IMPORT gfp_mul_asm
+    IMPORT gfp_sqr_asm
+    IMPORT gfp_mul32_asm
+    ALIGN 2
+    
+    
+;;;;;;;;;;;;;;;;;;;;
+;; Register Names ;;
+;;;;;;;;;;;;;;;;;;;;
+    
+x2Ptr    RN r4
+z2Ptr    RN r5
+x3Ptr    RN r6
+z3Ptr    RN r7
+t0Ptr    RN r8
+t1Ptr    RN r9
+t2Ptr    RN r10
+t3Ptr    RN r11
+Len      RN r12
+    
+    
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;; Montgomery Ladder Step (Addition+Doubling) ;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+    
+mon_ladder_step_asm PROC
+    
+    push  {r3-r11, lr}       ; push callee-saved registers (r3 for alignment)
+    ldr   Len, [sp, #40]
+    
+    ;; Compute pointers to the coordinates, allocate the temporary elements
+    ;; t0-t3 and the frame with len (5th parameter of callees), c, x, and a24
+    
+    mov   x2Ptr, r0
+    add   z2Ptr, x2Ptr, Len, LSL #2
+    add   x3Ptr, z2Ptr, Len, LSL #2
+    add   z3Ptr, x3Ptr, Len, LSL #2
+    sub   sp, sp, Len, LSL #3
+    sub   sp, sp, Len, LSL #3
+    mov   t0Ptr, sp
+    add   t1Ptr, t0Ptr, Len, LSL #2
+    add   t2Ptr, t1Ptr, Len, LSL #2
+    add   t3Ptr, t2Ptr, Len, LSL #2
+    sub   sp, sp, #16
+    str   Len, [sp, #0]
+    str   r3, [sp, #4]
+    str   r1, [sp, #8]
+    str   r2, [sp, #12]
+    
+    ;; Same sequence of field operations as in mon_ladder_step_c99
+    
+    mov   r0, t0Ptr       ; t0 := x2+z2
+    mov   r1, x2Ptr
+    mov   r2, z2Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_add_asm
+    
+    mov   r0, t1Ptr       ; t1 := x2-z2
+    mov   r1, x2Ptr
+    mov   r2, z2Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_sub_asm
+    
+    mov   r0, t2Ptr       ; t2 := x3+z3
+    mov   r1, x3Ptr
+    mov   r2, z3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_add_asm
+    
+    mov   r0, t3Ptr       ; t3 := x3-z3
+    mov   r1, x3Ptr
+    mov   r2, z3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_sub_asm
+    
+    mov   r0, x3Ptr       ; x3 := t3*t0
+    mov   r1, t3Ptr
+    mov   r2, t0Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_mul_asm
+    
+    mov   r0, z3Ptr       ; z3 := t2*t1
+    mov   r1, t2Ptr
+    mov   r2, t1Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_mul_asm
+    
+    mov   r0, t2Ptr       ; t2 := t0*t0
+    mov   r1, t0Ptr
+    ldr   r2, [sp, #4]
+    ldr   r3, [sp, #0]
+    bl    gfp_sqr_asm
+    
+    mov   r0, t3Ptr       ; t3 := t1*t1
+    mov   r1, t1Ptr
+    ldr   r2, [sp, #4]
+    ldr   r3, [sp, #0]
+    bl    gfp_sqr_asm
+    
+    mov   r0, t0Ptr       ; t0 := x3+z3
+    mov   r1, x3Ptr
+    mov   r2, z3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_add_asm
+    
+    mov   r0, t1Ptr       ; t1 := x3-z3
+    mov   r1, x3Ptr
+    mov   r2, z3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_sub_asm
+    
+    mov   r0, x3Ptr       ; x3 := t0*t0
+    mov   r1, t0Ptr
+    ldr   r2, [sp, #4]
+    ldr   r3, [sp, #0]
+    bl    gfp_sqr_asm
+    
+    mov   r0, t0Ptr       ; t0 := t1*t1
+    mov   r1, t1Ptr
+    ldr   r2, [sp, #4]
+    ldr   r3, [sp, #0]
+    bl    gfp_sqr_asm
+    
+    mov   r0, z3Ptr       ; z3 := x1*t0
+    ldr   r1, [sp, #8]
+    mov   r2, t0Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_mul_asm
+    
+    mov   r0, x2Ptr       ; x2 := t2*t3
+    mov   r1, t2Ptr
+    mov   r2, t3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_mul_asm
+    
+    mov   r0, t0Ptr       ; t0 := t2-t3
+    mov   r1, t2Ptr
+    mov   r2, t3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_sub_asm
+    
+    mov   r0, t1Ptr       ; t1 := t0*a24
+    mov   r1, t0Ptr
+    ldr   r2, [sp, #12]
+    ldr   r3, [sp, #4]
+    bl    gfp_mul32_asm
+    
+    mov   r0, t1Ptr       ; t1 := t1+t3
+    mov   r1, t1Ptr
+    mov   r2, t3Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_add_asm
+    
+    mov   r0, z2Ptr       ; z2 := t0*t1
+    mov   r1, t0Ptr
+    mov   r2, t1Ptr
+    ldr   r3, [sp, #4]
+    bl    gfp_mul_asm
+    
+    ldr   Len, [sp, #0]
+    add   sp, sp, #16
+    add   sp, sp, Len, LSL #3
+    add   sp, sp, Len, LSL #3
+    pop   {r3-r11, pc}
+    
+    ENDP
+    
+    
+    END
@@ -3,17 +3,36 @@
 
 #include "typedefs.h"
 
-/*------Assembler function prototypes------*/
-extern int  int_add_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, int len);
-extern int  int_shr_msp(UINT16 *r, const UINT16 *a, int len);
-extern int  int_sub_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, int len);
-
-extern void gfp_add_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, UINT16 c, int len);
-extern void gfp_cneg_msp(UINT16 *r, const UINT16 *a, int neg, UINT16 c, int len);
-extern void gfp_hlv_msp(UINT16 *r, const UINT16 *a, UINT16 c, int len);
-extern void gfp_mul_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, UINT16 c, int len);
-extern void gfp_mul32_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, UINT16 c, int len);
-extern void int_sqr_msp(UINT16 *r, const UINT16 *a, UINT16 c, int len);
-extern void gfp_sub_msp(UINT16 *r, const UINT16 *a, const UINT16 *b, UINT16 c, int len);
+#ifdef MSPECC_USE_ASM
+/*------MSP430 Assembler function prototypes (mspasm)------*/
+extern int  int_add_msp(Word *r, const Word *a, const Word *b, int len);
+extern int  int_shr_msp(Word *r, const Word *a, int len);
+extern int  int_sub_msp(Word *r, const Word *a, const Word *b, int len);
+
+extern void gfp_add_msp(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_cneg_msp(Word *r, const Word *a, Word c, int neg, int len);
+extern void gfp_hlv_msp(Word *r, const Word *a, Word c, int len);
+extern void gfp_mul_msp(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_mul32_msp(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_sqr_msp(Word *r, const Word *a, Word c, int len);
+extern void gfp_sub_msp(Word *r, const Word *a, const Word *b, Word c, int len);
+
+extern void mon_ladder_step_msp(Word *xz, const Word *x, const Word *a24, Word c, int len);
+#endif
+
+#ifdef MSPECC_USE_ARMASM
+/*------Cortex-M3 Assembler function prototypes (armasm)------*/
+extern int  int_add_asm(Word *r, const Word *a, const Word *b, int len);
+extern void int_mul_asm(Word *r, const Word *a, const Word *b, int len);
+extern void int_sqr_asm(Word *r, const Word *a, int len);
+
+extern void gfp_add_asm(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_mul_asm(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_mul32_asm(Word *r, const Word *a, const Word *b, Word c, int len);
+extern void gfp_sqr_asm(Word *r, const Word *a, Word c, int len);
+extern void gfp_sub_asm(Word *r, const Word *a, const Word *b, Word c, int len);
+
+extern void mon_ladder_step_asm(Word *xz, const Word *x, const Word *a24, Word c, int len);
+#endif
 
 #endif
@@ -0,0 +1,481 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "tweetstrobe.h"
+#include "xoodoo.h"
+#include "disco_asymmetric.h"
+#include "disco_symmetric.h"
+#include "gfparith.h"
+#include "moncurve.h"
+#include "tedcurve.h"
+#include "ecdparam.h"
+#include "ed25519.h"
+
+//
+// Cycle Counter
+// =============
+// bench_cycles() returns a free-running cycle count where the target has one
+// (TSC on x86, DWT on Cortex-M3) and falls back to clock() otherwise. On the
+// MSP430 the numbers are meant to be taken from the IAR simulator (Profiler
+// / cycle counter) around the calls of the bench_* functions.
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t bench_cycles(void) { return __rdtsc(); }
+#define BENCH_UNIT "cycles"
+#elif defined(__ARM_ARCH_7M__)
+#define DWT_CTRL   (*(volatile uint32_t *) 0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t *) 0xE0001004)
+#define DEMCR      (*(volatile uint32_t *) 0xE000EDFC)
+static inline uint64_t bench_cycles(void) {
+  if ((DWT_CTRL & 1) == 0) {
+    DEMCR |= (1UL << 24);  // enable trace
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= 1;         // enable cycle counter
+  }
+  return DWT_CYCCNT;
+}
+#define BENCH_UNIT "cycles"
+#else
+static inline uint64_t bench_cycles(void) { return (uint64_t) clock(); }
+#define BENCH_UNIT "clock ticks"
+#endif
+
+// number of repetitions per measurement (the minimum is reported)
+#ifndef BENCH_REPS
+#define BENCH_REPS 64
+#endif
+
+// Strobe rate in bytes (state size minus capacity minus padding)
+#define BENCH_STROBE_RATE (XOODOO_STATE_BYTES - 32 - 2)
+
+//
+// Xoodoo
+// ======
+
+void bench_xoodoo(void) {
+  kdomain_s state;
+  uint64_t start, cycles, best = UINT64_MAX;
+  int i, j;
+
+  memset(&state, 0, sizeof(state));
+  for (i = 0; i < BENCH_REPS; i++) {
+    start = bench_cycles();
+    for (j = 0; j < 16; j++) {
+      xoodoo_perm(state.b, XOODOO_MAX_ROUNDS);
+    }
+    cycles = (bench_cycles() - start) / 16;
+    if (cycles < best) best = cycles;
+  }
+
+#ifdef XOODOO_USE_ASM
+  printf("xoodoo_perm_msp (12 rounds): ");
+#else
+  printf("xoodoo_perm_c99 (12 rounds): ");
+#endif
+  printf("%llu %s/perm, %.2f %s/state-byte, %.2f %s/rate-byte\n",
+         (unsigned long long) best, BENCH_UNIT,
+         (double) best / XOODOO_STATE_BYTES, BENCH_UNIT,
+         (double) best / BENCH_STROBE_RATE, BENCH_UNIT);
+}
+
+//
+// Strobe / Disco record layer
+// ===========================
+
+void bench_hash(size_t len) {
+  static uint8_t input[4096], out[32];
+  uint64_t start, cycles, best = UINT64_MAX;
+  int i;
+
+  if (len > sizeof(input)) len = sizeof(input);
+  for (i = 0; i < BENCH_REPS; i++) {
+    start = bench_cycles();
+    disco_Hash(input, len, out, 32);
+    cycles = bench_cycles() - start;
+    if (cycles < best) best = cycles;
+  }
+
+  printf("disco_Hash (%u bytes): %llu %s, %.2f %s/byte\n", (unsigned) len,
+         (unsigned long long) best, BENCH_UNIT, (double) best / len,
+         BENCH_UNIT);
+}
+
+// encryption of one 'len'-byte record in each of 8 sessions, sequentially
+// with strobe_operate and in parallel with strobe_operate_batch
+void bench_enc_batch(size_t len) {
+  static uint8_t bufs[8][1024];
+  strobe_s sessions[8];
+  strobe_s *ps[8];
+  uint8_t *pb[8];
+  size_t lens[8];
+  uint64_t start, cycles, best_seq = UINT64_MAX, best_bat = UINT64_MAX;
+  int i, j;
+
+  if (len > sizeof(bufs[0])) len = sizeof(bufs[0]);
+  for (j = 0; j < 8; j++) {
+    strobe_init(&sessions[j], "bench", 5);
+    ps[j] = &sessions[j];
+    pb[j] = bufs[j];
+    lens[j] = len;
+  }
+  for (i = 0; i < BENCH_REPS; i++) {
+    start = bench_cycles();
+    for (j = 0; j < 8; j++) {
+      strobe_operate(&sessions[j], TYPE_ENC, bufs[j], len, false);
+    }
+    cycles = bench_cycles() - start;
+    if (cycles < best_seq) best_seq = cycles;
+    start = bench_cycles();
+    strobe_operate_batch(ps, TYPE_ENC, pb, lens, 8, false, NULL);
+    cycles = bench_cycles() - start;
+    if (cycles < best_bat) best_bat = cycles;
+  }
+
+  printf("8 x ENC (%u bytes): sequential %.2f %s/byte, batched (x%d) %.2f "
+         "%s/byte\n", (unsigned) len, (double) best_seq / (8 * len),
+         BENCH_UNIT, XOODOO_PAR_STATES, (double) best_bat / (8 * len),
+         BENCH_UNIT);
+}
+
+//
+// Curve25519
+// ==========
+
+#define BENCH_LEN (256/WSIZE)
+
+// time 'stmt' (minimum over 'reps' runs) and print it with 'name'
+#define BENCH_RUN(name, reps, stmt) do {                          \
+  uint64_t start_, cycles_, best_ = UINT64_MAX;                   \
+  int i_;                                                         \
+  for (i_ = 0; i_ < (reps); i_++) {                               \
+    start_ = bench_cycles();                                      \
+    stmt;                                                         \
+    cycles_ = bench_cycles() - start_;                            \
+    if (cycles_ < best_) best_ = cycles_;                         \
+  }                                                               \
+  printf("%s: %llu %s\n", (name), (unsigned long long) best_,     \
+         BENCH_UNIT);                                             \
+} while (0)
+
+void bench_x25519(void) {
+  Word a[BENCH_LEN], b[BENCH_LEN], r[BENCH_LEN], t[4*BENCH_LEN];
+  PROPOINT q = { t, &t[BENCH_LEN], &t[2*BENCH_LEN], NULL, &t[3*BENCH_LEN] };
+  int i;
+
+  for (i = 0; i < BENCH_LEN; i++) {
+    a[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+    b[i] = (Word) (0xC2B2AE3D27D4EB4FULL * (i + 1));
+  }
+  a[BENCH_LEN-1] &= ((Word) -1L) >> 1;
+  b[BENCH_LEN-1] &= ((Word) -1L) >> 1;
+
+  BENCH_RUN("gfp_mul_c99", BENCH_REPS, gfp_mul_c99(r, a, b, 19, BENCH_LEN));
+  BENCH_RUN("gfp_sqr_c99", BENCH_REPS, gfp_sqr_c99(r, a, 19, BENCH_LEN));
+  BENCH_RUN("gfp_mul_kara", BENCH_REPS, gfp_mul_kara(r, a, b, 19, BENCH_LEN));
+  BENCH_RUN("gfp_sqr_kara", BENCH_REPS, gfp_sqr_kara(r, a, 19, BENCH_LEN));
+#ifdef MSPECC_USE_R51
+  BENCH_RUN("gfp_mul_r51", BENCH_REPS, gfp_mul_r51(r, a, b, 19, BENCH_LEN));
+  BENCH_RUN("gfp_sqr_r51", BENCH_REPS, gfp_sqr_r51(r, a, 19, BENCH_LEN));
+#endif
+  BENCH_RUN("gfp_inv", 64, gfp_inv(r, a, 19, BENCH_LEN));
+  BENCH_RUN("gfp_inv_fermat", 64, gfp_inv_fermat(r, a, 19, BENCH_LEN));
+  BENCH_RUN("gfp_inv_sgcd", 64, gfp_inv_sgcd(r, a, 19, BENCH_LEN));
+  b[0] &= (Word) -8L;
+  b[BENCH_LEN-1] |= ((Word) 1) << (WSIZE - 2);
+  for (i = 0; i < BENCH_LEN; i++) {
+    t[i] = a[i]; t[BENCH_LEN+i] = b[i]; t[2*BENCH_LEN+i] = a[i] ^ b[i];
+    t[3*BENCH_LEN+i] = a[i] + b[i];
+  }
+  t[3*BENCH_LEN-1] &= ((Word) -1L) >> 1;
+  t[4*BENCH_LEN-1] &= ((Word) -1L) >> 1;
+  BENCH_RUN("mon_ladder_step", 256, mon_ladder_step(t, a, CURVE25519.a24,
+            19, BENCH_LEN));
+  BENCH_RUN("mon_mul_ladder", 16, mon_mul_ladder(&q, b, a, &CURVE25519));
+  BENCH_RUN("mon_mul_ladder_consttime", 16,
+            mon_mul_ladder_consttime(&q, b, a, &CURVE25519));
+  BENCH_RUN("mon_mul_varbase", 16, mon_mul_varbase(r, b, a, &CURVE25519));
+  BENCH_RUN("mon_mul_fixbase", 16, mon_mul_fixbase(r, b, &CURVE25519));
+}
+
+// fixed-base and variable-base scalar multiplication on the curves of
+// ecdparam.h that the Word size supports (the curves besides CURVE25519 are
+// benchmark-only and need MSPECC_BENCH_CURVES), ordered by the length of p;
+// with BENCH_NJ_PER_CYCLE (the energy per cycle of the target in nJ, e.g.
+// from its datasheet) also the energy is printed
+static uint64_t bench_curve_min(const ECDPARAM *m, Word *r, const Word *k,
+                                const Word *u, int fix) {
+  uint64_t start, cycles, best = UINT64_MAX;
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    start = bench_cycles();
+    if (fix) mon_mul_fixbase(r, k, m);
+    else mon_mul_varbase(r, k, u, m);
+    cycles = bench_cycles() - start;
+    if (cycles < best) best = cycles;
+  }
+  return best;
+}
+
+void bench_curves(void) {
+  static const struct { const char *name; const ECDPARAM *m; } crv[] = {
+#ifdef MSPECC_BENCH_CURVES
+#if (WSIZE != 64)
+    { "CURVE_P159", &CURVE_P159 },
+#endif
+    { "CURVE_P191", &CURVE_P191 },
+#if (WSIZE == 16)
+    { "CURVE20791", &CURVE20791 },
+#endif
+#if (WSIZE != 64)
+    { "CURVE_P223", &CURVE_P223 },
+#endif
+    { "CURVE_P255", &CURVE_P255 },
+#endif
+    { "CURVE25519", &CURVE25519 }
+  };
+  Word k[BENCH_LEN], u[BENCH_LEN], r[BENCH_LEN];
+  uint64_t fix, var;
+  size_t c;
+  int i, len;
+
+  for (c = 0; c < sizeof(crv)/sizeof(crv[0]); c++) {
+    len = crv[c].m->len;
+    for (i = 0; i < len; i++) k[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+    k[0] &= (Word) -8L;
+    k[len-1] &= ((Word) -1L) >> 1;
+    k[len-1] |= ((Word) 1) << (WSIZE - 2);
+    mon_mul_fixbase(u, k, crv[c].m);
+    fix = bench_curve_min(crv[c].m, r, k, u, 1);
+    var = bench_curve_min(crv[c].m, r, k, u, 0);
+    printf("%s (2^%d - %u): fixbase %llu, varbase %llu %s",
+           crv[c].name, WSIZE*len - 1, (unsigned) crv[c].m->c,
+           (unsigned long long) fix, (unsigned long long) var, BENCH_UNIT);
+#ifdef BENCH_NJ_PER_CYCLE
+    printf(" (%.1f + %.1f uJ)", fix*(BENCH_NJ_PER_CYCLE)/1000.0,
+           var*(BENCH_NJ_PER_CYCLE)/1000.0);
+#endif
+    printf("\n");
+  }
+}
+
+// double-base scalar multiplication k1*G + k2*P and point decompression
+// (signature verification)
+void bench_dblbase(void) {
+  Word k1[BENCH_LEN], k2[BENCH_LEN], x[2*BENCH_LEN], y[2*BENCH_LEN];
+  AFFPOINT p = { x, y }, r = { &x[BENCH_LEN], &y[BENCH_LEN] };
+  DBLSCALAR k = { k1, k2 };
+  int i;
+
+  for (i = 0; i < BENCH_LEN; i++) {
+    k1[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+    k2[i] = (Word) (0xC2B2AE3D27D4EB4FULL * (i + 1));
+  }
+  k1[BENCH_LEN-1] &= ((Word) -1L) >> 4;
+  k2[BENCH_LEN-1] &= ((Word) -1L) >> 4;
+  ted_mul_fixbase(&p, k2, &CURVE25519);
+
+  BENCH_RUN("ted_mul_varbase", 16, ted_mul_varbase(&r, k2, &p, &CURVE25519));
+  BENCH_RUN("ted_mul_fixbase", 16, ted_mul_fixbase(&r, k1, &CURVE25519));
+  BENCH_RUN("ted_mul_dblbase", 16, ted_mul_dblbase(&r, &k, &p, &CURVE25519));
+  ted_compress(k1, &p, &CURVE25519);
+  BENCH_RUN("ted_decompress", 16, ted_decompress(&r, k1, &CURVE25519));
+}
+
+// per-point cost of the interleaved (Straus) and the bucket (Pippenger)
+// multi-scalar multiplication for 64 to 4096 points
+void bench_msm(void) {
+  enum { NUM = 4096 };
+  static Word k[NUM*BENCH_LEN], x[(NUM+1)*BENCH_LEN], y[(NUM+1)*BENCH_LEN];
+  static AFFPOINT p[NUM];
+  AFFPOINT r = { &x[NUM*BENCH_LEN], &y[NUM*BENCH_LEN] };
+  uint64_t start, cycles, best_multi, best_msm;
+  int i, j, n;
+
+  for (i = 0; i < NUM*BENCH_LEN; i++) {
+    k[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+  }
+  for (i = 0; i < NUM; i++) {
+    p[i].x = &x[i*BENCH_LEN];
+    p[i].y = &y[i*BENCH_LEN];
+    k[i*BENCH_LEN+BENCH_LEN-1] &= ((Word) -1L) >> 4;
+    ted_mul_fixbase(&p[i], &k[i*BENCH_LEN], &CURVE25519);
+  }
+  for (n = 64; n <= NUM; n *= 4) {
+    best_multi = best_msm = UINT64_MAX;
+    for (j = 0; j < 2; j++) {
+      start = bench_cycles();
+      ted_mul_multi(&r, k, p, n, &CURVE25519);
+      cycles = bench_cycles() - start;
+      if (cycles < best_multi) best_multi = cycles;
+      start = bench_cycles();
+      ted_msm(&r, k, p, n, &CURVE25519);
+      cycles = bench_cycles() - start;
+      if (cycles < best_msm) best_msm = cycles;
+    }
+    printf("ted_mul_multi (%d): %llu %s per point\n", n,
+           (unsigned long long) (best_multi/n), BENCH_UNIT);
+    printf("ted_msm (%d, %d threads): %llu %s per point\n", n,
+           MSPECC_MSM_THREADS, (unsigned long long) (best_msm/n), BENCH_UNIT);
+  }
+}
+
+// Ed25519 signature generation and verification of a 64-byte message
+void bench_ed25519(void) {
+  uint8_t sk[ED25519_KEY_BYTES], pk[ED25519_KEY_BYTES];
+  uint8_t sig[ED25519_SIG_BYTES], msg[64];
+  int i;
+
+  for (i = 0; i < ED25519_KEY_BYTES; i++) sk[i] = (uint8_t) (7*i + 1);
+  for (i = 0; i < 64; i++) msg[i] = (uint8_t) i;
+  ed25519_pubkey(pk, sk);
+  ed25519_sign(sig, msg, 64, sk, pk);
+
+  BENCH_RUN("ed25519_sign", 16, ed25519_sign(sig, msg, 64, sk, pk));
+  BENCH_RUN("ed25519_verify", 16, ed25519_verify(sig, msg, 64, pk));
+}
+
+// per-signature cost of the batch verification of 64 and 256 signatures
+void bench_ed25519_batch(void) {
+  enum { NUM = 256 };
+  static uint8_t pk[NUM][ED25519_KEY_BYTES], sig[NUM][ED25519_SIG_BYTES];
+  static uint8_t msg[NUM][64];
+  static const uint8_t *ps[NUM], *pm[NUM], *pp[NUM];
+  static size_t len[NUM];
+  uint8_t sk[ED25519_KEY_BYTES];
+  uint64_t start, cycles, best;
+  int i, j, n;
+
+  for (i = 0; i < NUM; i++) {
+    for (j = 0; j < ED25519_KEY_BYTES; j++) sk[j] = (uint8_t) (7*j + i);
+    for (j = 0; j < 64; j++) msg[i][j] = (uint8_t) (i + j);
+    ed25519_pubkey(pk[i], sk);
+    ed25519_sign(sig[i], msg[i], 64, sk, pk[i]);
+    ps[i] = sig[i];
+    pm[i] = msg[i];
+    pp[i] = pk[i];
+    len[i] = 64;
+  }
+  for (n = 64; n <= NUM; n *= 4) {
+    best = UINT64_MAX;
+    for (i = 0; i < 4; i++) {
+      start = bench_cycles();
+      ed25519_verify_batch(ps, pm, len, pp, n, NULL);
+      cycles = bench_cycles() - start;
+      if (cycles < best) best = cycles;
+    }
+    printf("ed25519_verify_batch (%d): %llu %s per signature\n", n,
+           (unsigned long long) (best/n), BENCH_UNIT);
+  }
+}
+
+// per-result cost of batches of MSPECC_MAX_BATCH scalar multiplications
+void bench_x25519_batch(void) {
+  Word k[MSPECC_MAX_BATCH*BENCH_LEN], x[MSPECC_MAX_BATCH*BENCH_LEN];
+  Word r[MSPECC_MAX_BATCH*BENCH_LEN];
+  uint64_t start, cycles, best_var = UINT64_MAX, best_fix = UINT64_MAX;
+  int i;
+
+  for (i = 0; i < MSPECC_MAX_BATCH*BENCH_LEN; i++) {
+    k[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+    x[i] = (Word) (0xC2B2AE3D27D4EB4FULL * (i + 1));
+  }
+  for (i = 0; i < MSPECC_MAX_BATCH; i++) {
+    x[i*BENCH_LEN+BENCH_LEN-1] &= ((Word) -1L) >> 1;
+  }
+  for (i = 0; i < 4; i++) {
+    start = bench_cycles();
+    mon_mul_varbase_batch(r, k, x, MSPECC_MAX_BATCH, &CURVE25519);
+    cycles = bench_cycles() - start;
+    if (cycles < best_var) best_var = cycles;
+    start = bench_cycles();
+    mon_mul_fixbase_batch(r, k, MSPECC_MAX_BATCH, &CURVE25519);
+    cycles = bench_cycles() - start;
+    if (cycles < best_fix) best_fix = cycles;
+  }
+  printf("mon_mul_varbase_batch (%d): %llu %s per result\n", MSPECC_MAX_BATCH,
+         (unsigned long long) (best_var/MSPECC_MAX_BATCH), BENCH_UNIT);
+  printf("mon_mul_fixbase_batch (%d): %llu %s per result\n", MSPECC_MAX_BATCH,
+         (unsigned long long) (best_fix/MSPECC_MAX_BATCH), BENCH_UNIT);
+}
+
+// average cost of the key generation with and without an Elligator 2
+// representative of the public key, and of the naive generation that draws a
+// new key pair (one scalar multiplication) until it has a representative
+void bench_keygen(void) {
+  enum { NUM = 256 };
+  keyPair kp;
+  Word r[BENCH_LEN];
+  uint64_t start, plain, repr, naive;
+  int i;
+
+  srand(1);
+  start = bench_cycles();
+  for (i = 0; i < NUM; i++) disco_generateKeyPair(&kp);
+  plain = bench_cycles() - start;
+  start = bench_cycles();
+  for (i = 0; i < NUM; i++) {
+    disco_generateRepresentableKeyPair(&kp, (uint8_t *) r);
+  }
+  repr = bench_cycles() - start;
+  start = bench_cycles();
+  for (i = 0; i < NUM; i++) {
+    do disco_generateKeyPair(&kp);
+    while (mon_elligator_encode(r, (Word *) kp.pub, &CURVE25519));
+  }
+  naive = bench_cycles() - start;
+  printf("disco_generateKeyPair: %llu %s\n",
+         (unsigned long long) (plain/NUM), BENCH_UNIT);
+  printf("disco_generateRepresentableKeyPair: %llu %s\n",
+         (unsigned long long) (repr/NUM), BENCH_UNIT);
+  printf("disco_generateKeyPair until representable: %llu %s\n",
+         (unsigned long long) (naive/NUM), BENCH_UNIT);
+  BENCH_RUN("mon_elligator_decode", 64,
+            mon_elligator_decode((Word *) kp.pub, r, &CURVE25519));
+}
+
+// DH throughput of the single and the multi-buffer (8 results) ladder, the
+// number of operations per second is measured with clock() on one core
+void bench_x25519_throughput(void) {
+  Word k[8*BENCH_LEN], x[8*BENCH_LEN], r[8*BENCH_LEN];
+  clock_t start;
+  double secs;
+  int i, n;
+
+  for (i = 0; i < 8*BENCH_LEN; i++) {
+    k[i] = (Word) (0x9E3779B97F4A7C15ULL * (i + 1));
+    x[i] = (Word) (0xC2B2AE3D27D4EB4FULL * (i + 1));
+  }
+  for (i = 0; i < 8; i++) x[i*BENCH_LEN+BENCH_LEN-1] &= ((Word) -1L) >> 1;
+
+  start = clock();
+  for (n = 0; n < 512; n++) mon_mul_varbase(r, k, x, &CURVE25519);
+  secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+  printf("mon_mul_varbase: %.0f DH/s\n", n / secs);
+  start = clock();
+  for (n = 0; n < 512; n += 8) mon_mul_varbase_x8(r, k, x, &CURVE25519);
+  secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+  printf("mon_mul_varbase_x8 (%d lanes): %.0f DH/s\n", MON_PAR_LANES,
+         n / secs);
+}
+
+int main() {
+  bench_xoodoo();
+  bench_hash(64);
+  bench_hash(1024);
+  bench_enc_batch(64);
+  bench_enc_batch(1024);
+  bench_x25519();
+  bench_curves();
+  bench_x25519_batch();
+  bench_keygen();
+  bench_dblbase();
+  bench_msm();
+  bench_ed25519();
+  bench_ed25519_batch();
+  bench_x25519_throughput();
+  return 0;
+}
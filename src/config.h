@@ -6,16 +6,48 @@
 #include <limits.h>
 
 
+// MSPECC_WSIZE is the size of a Word in bits: 16 on 16-bit CPUs, 64 on 64-bit
+// CPUs whose compiler supports unsigned __int128 (the double-length word), and
+// 32 otherwise. It can be set on the command line to override the default.
+#ifndef MSPECC_WSIZE
 #if (UINT_MAX <= 65535)
+#define MSPECC_WSIZE 16
+#elif defined(__SIZEOF_INT128__)
+#define MSPECC_WSIZE 64
+#else
+#define MSPECC_WSIZE 32
+#endif
+#endif
+
+#if (MSPECC_WSIZE == 16)
 typedef uint16_t Word;   // single-length word
 typedef uint32_t DWord;  // double-length word
 typedef int32_t SDWord;  // signed double-length word
 #define WSIZE 16
-#else  // 32/64-bit CPU
+#elif (MSPECC_WSIZE == 32)
 typedef uint32_t Word;   // single-length word
 typedef uint64_t DWord;  // double-length word
 typedef int64_t SDWord;  // signed double-length word
 #define WSIZE 32
+#elif (MSPECC_WSIZE == 64)
+typedef uint64_t Word;             // single-length word
+typedef unsigned __int128 DWord;   // double-length word
+typedef __int128 SDWord;           // signed double-length word
+#define WSIZE 64
+#else
+#error "MSPECC_WSIZE must be 16, 32, or 64!"
+#endif
+
+// MSPECC_SMALL_STACK selects the defaults of the size parameters below for
+// targets with a few kB of RAM, i.e. the stack use of a function stays in the
+// order of the field-element arrays. It is defined for the MSP430 and the
+// Cortex-M (and by the CMake build for all cross builds); hosts get defaults
+// that favor speed over stack space.
+#ifndef MSPECC_SMALL_STACK
+#if defined(__MSP430__) || defined(__ICC430__) || defined(__ARM_ARCH_6M__) \
+    || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define MSPECC_SMALL_STACK
+#endif
 #endif
 
 
@@ -23,13 +55,169 @@ typedef int64_t SDWord;  // signed double-length word
 
 #define MSPECC_MAX_LEN 256
 
-// 
+// MSPECC_USE_ASM selects the MSP430 Assembler functions in mspasm (IAR syntax)
+// and MSPECC_USE_ARMASM the Cortex-M3 Assembler functions in armasm (Keil/ARM
+// syntax); each is defined by default when compiling with the corresponding
+// toolchain. Define MSPECC_NO_ASM to use the C99 functions on all targets.
+#ifndef MSPECC_NO_ASM
+#if defined(__ICC430__)
 #define MSPECC_USE_ASM
+#elif (defined(__CC_ARM) || defined(__ARMCC_VERSION)) && (WSIZE == 32)
+#define MSPECC_USE_ARMASM
+#endif
+#endif
 
 // define MSPECC_USE_VLA to use Variable-Length Arrays (VLA)
 // undefine it to use static arrays of length MSPECC_MAX_LEN
 // #define MSPECC_USE_VLA
 
+// define MSPECC_USE_CT_INV to invert the Z coordinate in the projective to
+// affine conversions with a constant-time algorithm (gfp_inv_ct). Undefine it
+// (MSPECC_NO_CT_INV) to use the masked binary extended Euclidean algorithm
+// (gfp_inv) instead, which has a data-dependent execution time.
+#ifndef MSPECC_NO_CT_INV
+#define MSPECC_USE_CT_INV
+#endif
+
+// define MSPECC_USE_CT_COMB to load the points of the fixed-base comb tables
+// in constant time: all entries of the table (or of one comb) are read and
+// the requested one is selected with a mask, using SSE2 or AVX2 on x86 hosts.
+// Define MSPECC_NO_CT_COMB to index the tables directly with the digits of
+// the (secret) scalar, which leaks them through the cache on CPUs that have
+// a data cache.
+#ifndef MSPECC_NO_CT_COMB
+#define MSPECC_USE_CT_COMB
+#endif
+
+// define MSPECC_USE_SAFEGCD to use the safegcd algorithm of Bernstein and Yang
+// (gfp_inv_sgcd) for constant-time inversion, undefine it to use Fermat's
+// little theorem (gfp_inv_fermat). The former operates on 62-bit or 30-bit
+// signed digits and is defined by default for 32-bit and 64-bit Words; the
+// latter needs only the field multiplication and squaring and is therefore
+// the default on 16-bit CPUs. Define MSPECC_NO_SAFEGCD to always use Fermat.
+#if (WSIZE >= 32) && !defined(MSPECC_NO_SAFEGCD)
+#define MSPECC_USE_SAFEGCD
+#endif
+
+// MSPECC_MAX_BATCH is the number of scalar multiplications whose inversions
+// the batched functions (e.g. mon_mul_varbase_batch) combine into a single
+// one; larger batches are processed in chunks of MSPECC_MAX_BATCH. A chunk
+// needs 2*MSPECC_MAX_BATCH gfp elements on the stack.
+#ifndef MSPECC_MAX_BATCH
+#define MSPECC_MAX_BATCH 8
+#endif
+
+// MSPECC_FIXED_LEN is the length (in Words) of the field elements for which
+// gfp_mul_c99 and gfp_sqr_c99 use kernels with a constant length, which the
+// compiler unrolls completely (product scanning with the column sums held in
+// registers); other lengths are handled by the generic loops. It defaults to
+// the length of Curve25519 (256/WSIZE) for the C99 functions. The unrolled
+// kernels increase code size, which matters on small MCUs; define
+// MSPECC_NO_FIXED_LEN to use only the generic loops.
+#if !defined(MSPECC_FIXED_LEN) && !defined(MSPECC_NO_FIXED_LEN)
+#define MSPECC_FIXED_LEN (256/WSIZE)
+#endif
+
+// MSPECC_KARA_THRESHOLD is the smallest length (in Words) of the operands
+// that int_mul_kara and int_sqr_kara split into two halves (subtractive
+// Karatsuba); shorter operands are multiplied with int_mul and int_sqr. For
+// len = 16 (Curve25519 with 16-bit Words), a threshold of 16 gives a single
+// level of Karatsuba and a threshold of 8 gives two levels. The defaults are
+// one level for Curve25519 on 16-bit CPUs, where word-products are expensive
+// relative to additions, and 32 Words otherwise, which is the break-even
+// point of the multiplication on x86-64 for all three Word sizes.
+#ifndef MSPECC_KARA_THRESHOLD
+#if (WSIZE == 16)
+#define MSPECC_KARA_THRESHOLD 16
+#else
+#define MSPECC_KARA_THRESHOLD 32
+#endif
+#endif
+
+// MSPECC_KARA_MAX_LEN is the largest length (in Words) of the operands of
+// int_mul_kara and int_sqr_kara, which sizes their temporary arrays (2*len
+// Words on each level of the recursion, i.e. 2 kB per level for 128 64-bit
+// Words). With MSPECC_SMALL_STACK it is the length of the largest field
+// element, otherwise 128 Words (at least four times the threshold).
+#ifndef MSPECC_KARA_MAX_LEN
+#ifdef MSPECC_SMALL_STACK
+#define MSPECC_KARA_MAX_LEN (MSPECC_MAX_LEN/WSIZE)
+#else
+#define MSPECC_KARA_MAX_LEN 128
+#endif
+#endif
+
+// MSPECC_COMB_TEETH and MSPECC_COMB_COMBS configure the fixed-base comb of
+// ted_mul_comb, which recodes the scalar into signed digits and uses a table
+// of MSPECC_COMB_COMBS*2^(MSPECC_COMB_TEETH-1) points generated offline by
+// gen_param (e.g. 8 teeth and 4 combs: 512 points or 48 kB for Curve25519, 7
+// doublings and 32 additions). When they are not defined (default on embedded
+// targets), ted_mul_comb uses the 16-point table of ted_mul_comb4b with 4
+// teeth (63 doublings and 64 additions).
+#if defined(MSPECC_COMB_TEETH) && !defined(MSPECC_COMB_COMBS)
+#define MSPECC_COMB_COMBS 1
+#endif
+
+// MSPECC_WNAF_WIDTH is the window width W of the sliding-window NAF of the
+// variable-base scalar in ted_mul_dblbase, which computes a table of the
+// 2^(W-2) odd multiples of the point on the fly (W = 5: 8 points and about
+// w*len/6 additions)
+#ifndef MSPECC_WNAF_WIDTH
+#define MSPECC_WNAF_WIDTH 5
+#endif
+
+// MSPECC_MAX_MULTI is the number of points whose scalar multiplications
+// ted_mul_multi interleaves with a shared chain of doublings; more points are
+// processed in chunks of MSPECC_MAX_MULTI. A chunk needs the tables of odd
+// multiples of its points and their NAFs on the stack, i.e.
+// MSPECC_MAX_MULTI*(2^(W-2)*4 gfp elements + w*len+1 bytes). For Curve25519
+// (32-byte gfp elements) and W = 5, that is about 1.3 kB per point: 40 kB for
+// 32 points (the default on hosts) and 5 kB for 4 points (MSPECC_SMALL_STACK).
+#ifndef MSPECC_MAX_MULTI
+#ifdef MSPECC_SMALL_STACK
+#define MSPECC_MAX_MULTI 4
+#else
+#define MSPECC_MAX_MULTI 32
+#endif
+#endif
+
+// MSPECC_MSM_MAX_WINDOW is the largest window width c that ted_msm (bucket
+// method) selects; it bounds the 2^(c-1) buckets of ted_msm_window on the
+// stack (5 gfp elements each). The worst-case stack use of ted_msm for
+// Curve25519 (32-byte gfp elements) is about 160*2^(c-1) bytes of buckets
+// plus 1 kB, i.e. 80 kB for c = 10 (the default on hosts, which suffices for
+// about 10^4 points) and 6 kB for c = 6 (MSPECC_SMALL_STACK). With threads,
+// the sums of all w*len+1 possible windows are stored as well (25 kB, and
+// each thread has its own buckets). MSPECC_MSM_THREADS > 1 distributes the
+// windows of ted_msm among that many POSIX threads (see DISCO_MSM_THREADS in
+// CMakeLists.txt).
+#ifndef MSPECC_MSM_MAX_WINDOW
+#ifdef MSPECC_SMALL_STACK
+#define MSPECC_MSM_MAX_WINDOW 6
+#else
+#define MSPECC_MSM_MAX_WINDOW 10
+#endif
+#endif
+#ifndef MSPECC_MSM_THREADS
+#define MSPECC_MSM_THREADS 1
+#endif
+
+// MSPECC_VERIFY_BATCH is the number of signatures that ed25519_verify_batch
+// combines into one equation; a group needs 6*MSPECC_VERIFY_BATCH gfp
+// elements and 2*MSPECC_VERIFY_BATCH AFFPOINTs on the stack, i.e. about
+// 200 bytes per signature for Curve25519 (56 kB for 256 signatures, the
+// default on hosts, and 3 kB for 16 signatures with MSPECC_SMALL_STACK).
+// Groups of 128 or more signatures use the bucket method ted_msm, smaller
+// ones the interleaved ted_mul_multi, whose stack use (see
+// MSPECC_MSM_MAX_WINDOW and MSPECC_MAX_MULTI) adds to that of the group.
+#ifndef MSPECC_VERIFY_BATCH
+#ifdef MSPECC_SMALL_STACK
+#define MSPECC_VERIFY_BATCH 16
+#else
+#define MSPECC_VERIFY_BATCH 256
+#endif
+#endif
+
 #ifndef NDEBUG
 #define MSPECC_DEBUG_PRINT
 #endif
@@ -38,7 +226,26 @@ typedef int64_t SDWord;  // signed double-length word
 #define MSPECC_ERR_INVERSION_ZERO 1
 #define MSPECC_ERR_INVALID_POINT  2
 #define MSPECC_ERR_INVALID_SCALAR 4
+#define MSPECC_ERR_INVALID_SIGNATURE 8
 
+// define MSPECC_USE_R51 to use the radix-2^51 multiplication, squaring, and
+// multiplication by a 32-bit integer (five 51-bit limbs, 128-bit products)
+// for 255-bit fields such as Curve25519; other fields use the C99 functions.
+// It is defined by default for 32-bit Words when the compiler supports an
+// unsigned __int128 and no Assembler functions are used. With 64-bit Words,
+// the C99 functions are faster (16 word-products and no conversion). Define
+// MSPECC_NO_R51 to always use the C99 functions.
+#if defined(__SIZEOF_INT128__) && (WSIZE == 32) && !defined(MSPECC_NO_R51)
+#if !defined(MSPECC_USE_ASM) && !defined(MSPECC_USE_ARMASM)
+#define MSPECC_USE_R51
+#endif
+#endif
+
+// define MSPECC_USE_ASM_LADDER to use the Assembler ladder step of the
+// target (mon_ladder_step_msp or mon_ladder_step_asm) instead of the C99 one,
+// which calls the Assembler field operations as well. The two Assembler
+// kernels have not yet been assembled and checked against test_X25519 on a
+// target, so they are only used on request.
 #ifdef MSPECC_USE_ASM
 #include "asmfncts.h"
 #define int_add(r, a, b, len) int_add_msp((r), (a), (b), (len))
@@ -47,12 +254,38 @@ typedef int64_t SDWord;  // signed double-length word
 #define int_sqr(r, a, len) int_sqr_c99((r), (a), (len))
 #define int_sub(r, a, b, len) int_sub_msp((r), (a), (b), (len))
 #define gfp_add(r, a, b, c, len) gfp_add_msp((r), (a), (b), (c), (len))
-#define gfp_cneg(r, a, neg, c, len) gfp_cneg_msp((r), (a), (neg), (c), (len))
+#define gfp_cneg(r, a, c, neg, len) gfp_cneg_msp((r), (a), (c), (neg), (len))
 #define gfp_hlv(r, a, c, len) gfp_hlv_msp((r), (a), (c), (len))
 #define gfp_mul(r, a, b, c, len) gfp_mul_msp((r), (a), (b), (c), (len))
 #define gfp_mul32(r, a, b, c, len) gfp_mul32_msp((r), (a), (b), (c), (len))
+#define gfp_mul32add(r, a, b, d, c, len) gfp_mul32add_c99((r), (a), (b), (d), (c), (len))
 #define gfp_sqr(r, a, c, len) gfp_sqr_msp((r), (a), (c), (len))
 #define gfp_sub(r, a, b, c, len) gfp_sub_msp((r), (a), (b), (c), (len))
+#ifdef MSPECC_USE_ASM_LADDER
+#define mon_ladder_step(xz, x, a24, c, len) mon_ladder_step_msp((xz), (x), (a24), (c), (len))
+#else
+#define mon_ladder_step(xz, x, a24, c, len) mon_ladder_step_c99((xz), (x), (a24), (c), (len))
+#endif
+#elif defined(MSPECC_USE_ARMASM)
+#include "asmfncts.h"
+#define int_add(r, a, b, len) int_add_asm((r), (a), (b), (len))
+#define int_mul(r, a, b, len) int_mul_asm((r), (a), (b), (len))
+#define int_shr(r, a, len) int_shr_c99((r), (a), (len))
+#define int_sqr(r, a, len) int_sqr_asm((r), (a), (len))
+#define int_sub(r, a, b, len) int_sub_c99((r), (a), (b), (len))
+#define gfp_add(r, a, b, c, len) gfp_add_asm((r), (a), (b), (c), (len))
+#define gfp_cneg(r, a, c, neg, len) gfp_cneg_c99((r), (a), (c), (neg), (len))
+#define gfp_hlv(r, a, c, len) gfp_hlv_c99((r), (a), (c), (len))
+#define gfp_mul(r, a, b, c, len) gfp_mul_asm((r), (a), (b), (c), (len))
+#define gfp_mul32(r, a, b, c, len) gfp_mul32_asm((r), (a), (b), (c), (len))
+#define gfp_mul32add(r, a, b, d, c, len) gfp_mul32add_c99((r), (a), (b), (d), (c), (len))
+#define gfp_sqr(r, a, c, len) gfp_sqr_asm((r), (a), (c), (len))
+#define gfp_sub(r, a, b, c, len) gfp_sub_asm((r), (a), (b), (c), (len))
+#ifdef MSPECC_USE_ASM_LADDER
+#define mon_ladder_step(xz, x, a24, c, len) mon_ladder_step_asm((xz), (x), (a24), (c), (len))
+#else
+#define mon_ladder_step(xz, x, a24, c, len) mon_ladder_step_c99((xz), (x), (a24), (c), (len))
+#endif
 #else
 #define int_add(r, a, b, len) int_add_c99((r), (a), (b), (len))
 #define int_mul(r, a, b, len) int_mul_c99((r), (a), (b), (len))
@@ -60,12 +293,37 @@ typedef int64_t SDWord;  // signed double-length word
 #define int_sqr(r, a, len) int_sqr_c99((r), (a), (len))
 #define int_sub(r, a, b, len) int_sub_c99((r), (a), (b), (len))
 #define gfp_add(r, a, b, c, len) gfp_add_c99((r), (a), (b), (c), (len))
-#define gfp_cneg(r, a, neg, c, len) gfp_cneg_c99((r), (a), (neg), (c), (len))
+#define gfp_cneg(r, a, c, neg, len) gfp_cneg_c99((r), (a), (c), (neg), (len))
 #define gfp_hlv(r, a, c, len) gfp_hlv_c99((r), (a), (c), (len))
+#ifdef MSPECC_USE_R51
+#define gfp_mul(r, a, b, c, len) gfp_mul_r51((r), (a), (b), (c), (len))
+#define gfp_mul32(r, a, b, c, len) gfp_mul32_r51((r), (a), (b), (c), (len))
+#define gfp_mul32add(r, a, b, d, c, len) gfp_mul32add_r51((r), (a), (b), (d), (c), (len))
+#define gfp_sqr(r, a, c, len) gfp_sqr_r51((r), (a), (c), (len))
+#else
 #define gfp_mul(r, a, b, c, len) gfp_mul_c99((r), (a), (b), (c), (len))
 #define gfp_mul32(r, a, b, c, len) gfp_mul32_c99((r), (a), (b), (c), (len))
+#define gfp_mul32add(r, a, b, d, c, len) gfp_mul32add_c99((r), (a), (b), (d), (c), (len))
 #define gfp_sqr(r, a, c, len) gfp_sqr_c99((r), (a), (c), (len))
+#endif  // MSPECC_USE_R51
 #define gfp_sub(r, a, b, c, len) gfp_sub_c99((r), (a), (b), (c), (len))
-#endif  // MSPECC_USE_ASM
+#define mon_ladder_step(xz, x, a24, c, len) mon_ladder_step_c99((xz), (x), (a24), (c), (len))
+#endif  // MSPECC_USE_ASM, MSPECC_USE_ARMASM
+
+// define MSPECC_USE_KARA to use the Karatsuba functions (gfp_mul_kara and
+// gfp_sqr_kara) for the field multiplication and squaring instead of the
+// C99, R51, or Assembler functions selected above.
+#ifdef MSPECC_USE_KARA
+#undef gfp_mul
+#undef gfp_sqr
+#define gfp_mul(r, a, b, c, len) gfp_mul_kara((r), (a), (b), (c), (len))
+#define gfp_sqr(r, a, c, len) gfp_sqr_kara((r), (a), (c), (len))
+#endif
+
+#ifdef MSPECC_USE_SAFEGCD
+#define gfp_inv_ct(r, a, c, len) gfp_inv_sgcd((r), (a), (c), (len))
+#else
+#define gfp_inv_ct(r, a, c, len) gfp_inv_fermat((r), (a), (c), (len))
+#endif
 
 #endif  // _CONFIG_H
@@ -3,7 +3,6 @@
 #include "tedcurve.h"
 #include "moncurve.h"
 #include "ecdparam.h"
-#include "tweetX25519.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -39,10 +38,11 @@ static inline void DH(keyPair mine, keyPair theirs, uint8_t *output) {
   // use TweetNaCl
   // crypto_scalarmult(output, mine.priv, theirs.pub);
    
-  // use our MSP Assembler
-  uint16_t* k = (uint16_t *)mine.priv;
-  k[15] &= 0x7FFF; k[15] |= 0x4000; k[0] &= 0xFFF8;
-  mon_mul_varbase((uint16_t *)output, (uint16_t *)mine.priv, (uint16_t *)theirs.pub, &CURVE25519);
+  // use our MSP Assembler (the keys are little-endian byte arrays, which
+  // are aligned such that they can be accessed as arrays of Words)
+  uint8_t* k = mine.priv;
+  k[31] &= 0x7F; k[31] |= 0x40; k[0] &= 0xF8;
+  mon_mul_varbase((Word *)output, (Word *)mine.priv, (Word *)theirs.pub, &CURVE25519);
 }
 
 void disco_generateKeyPair(keyPair *kp) {
@@ -51,15 +51,35 @@ void disco_generateKeyPair(keyPair *kp) {
 
   // use our MSP Assembler
   for (int i = 0; i < 32; i++) kp->priv[i] = (uint8_t) rand();
-  uint16_t* k = (uint16_t *)kp->priv;
-  k[15] &= 0x7FFF; k[15] |= 0x4000; k[0] &= 0xFFF8;
+  uint8_t* k = kp->priv;
+  k[31] &= 0x7F; k[31] |= 0x40; k[0] &= 0xF8;
     
-  mon_mul_fixbase((uint16_t *)kp->pub, (uint16_t *)kp->priv, &CURVE25519);
+  mon_mul_fixbase((Word *)kp->pub, (Word *)kp->priv, &CURVE25519);
 
   kp->isSet = true;  // TODO: is this useful? If it is, should we use a magic
                      // number here in case it's not initialized to false?
 }
 
+void disco_generateRepresentableKeyPair(keyPair *kp, uint8_t *repr) {
+  // the scalar is incremented by 8 until the public key has an Elligator 2
+  // representative, i.e. there is only one scalar multiplication; a random
+  // byte selects the low-order component of the public key and the two top
+  // bits of the representative (which are otherwise always 0); when this
+  // fails (e.g. MSPECC_ERR_INVALID_SCALAR when the increments reach the top
+  // bit of the scalar, pub and repr are then zeroed), a fresh scalar is taken
+  int tweak = rand() & 0xFF;
+  uint8_t* k = kp->priv;
+  int err;
+  do {
+    for (int i = 0; i < 32; i++) kp->priv[i] = (uint8_t) rand();
+    k[31] &= 0x7F; k[31] |= 0x40; k[0] &= 0xF8;
+    err = mon_mul_fixbase_elligator((Word *)kp->pub, (Word *)repr,
+                                    (Word *)kp->priv, tweak, &CURVE25519);
+  } while (err != MSPECC_NO_ERROR);
+
+  kp->isSet = true;
+}
+
 //
 // SymmetricState
 // ==============
@@ -333,7 +353,10 @@ bool disco_WriteMessage(handshakeState *hs, uint8_t *payload,
   // Fetches and deletes the next message pattern from message_patterns
   assert(hs->message_patterns != NULL);
   uint8_t *p = message_buffer;
-  uint8_t DH_result[32];
+  uint8_t DH_result[32] __attribute__((aligned(8)));
+#ifdef DISCO_ELLIGATOR
+  uint8_t repr[32] __attribute__((aligned(8)));
+#endif
 
   // state machine
   const char *current_token = hs->message_patterns;
@@ -341,10 +364,18 @@ bool disco_WriteMessage(handshakeState *hs, uint8_t *payload,
     switch (*current_token) {
       case token_e:
         assert(!hs->e.isSet);
+#ifdef DISCO_ELLIGATOR
+        // the representative is sent (and hashed) instead of the public key
+        disco_generateRepresentableKeyPair(&(hs->e), repr);
+        memcpy(p, repr, 32);
+        p += 32;
+        mixHash(&(hs->symmetric_state), repr, 32);
+#else
         disco_generateKeyPair(&(hs->e));
         memcpy(p, hs->e.pub, 32);
         p += 32;
         mixHash(&(hs->symmetric_state), hs->e.pub, 32);
+#endif
         break;
       case token_s:
         assert(hs->s.isSet);
@@ -449,7 +480,10 @@ bool disco_ReadMessage(handshakeState *hs, uint8_t *message, size_t message_len,
   if (message_len >= 65535) {
     return false;
   }
-  uint8_t DH_result[32];
+  uint8_t DH_result[32] __attribute__((aligned(8)));
+#ifdef DISCO_ELLIGATOR
+  uint8_t repr[32] __attribute__((aligned(8)));
+#endif
 
   // state machine
   const char *current_token = hs->message_patterns;
@@ -460,11 +494,17 @@ bool disco_ReadMessage(handshakeState *hs, uint8_t *message, size_t message_len,
           return false;
         }
         assert(!hs->re.isSet);
+#ifdef DISCO_ELLIGATOR
+        memcpy(repr, message, 32);
+        mon_elligator_decode((Word *)hs->re.pub, (Word *)repr, &CURVE25519);
+        mixHash(&(hs->symmetric_state), repr, 32);
+#else
         memcpy(hs->re.pub, message, 32);
+        mixHash(&(hs->symmetric_state), hs->re.pub, 32);
+#endif
         message_len -= 32;
         message += 32;
         hs->re.isSet = true;
-        mixHash(&(hs->symmetric_state), hs->re.pub, 32);
         break;
       case token_s:
         assert(!hs->rs.isSet);
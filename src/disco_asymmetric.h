@@ -22,9 +22,10 @@
 #define MAX_SIZE_MESSAGE 65000
 
 // asymmetric
+// (the keys are aligned to 8 bytes so that they can be accessed as Words)
 typedef struct keyPair_ {
-  uint8_t priv[32] __attribute__((aligned(2)));
-  uint8_t pub[32] __attribute__((aligned(2)));
+  uint8_t priv[32] __attribute__((aligned(8)));
+  uint8_t pub[32] __attribute__((aligned(8)));
   bool isSet;
 } keyPair;
 
@@ -84,6 +85,12 @@ typedef struct handshakeState_ {
 // used to generate long-term key pairs for a peer
 void disco_generateKeyPair(keyPair *kp);
 
+// used to generate key pairs whose public key has an Elligator 2
+// representative 'repr' (32 bytes, aligned like the keys), which looks like a
+// random string; the ephemeral keys of token_e are generated and sent this
+// way when DISCO_ELLIGATOR is defined (for both peers)
+void disco_generateRepresentableKeyPair(keyPair *kp, uint8_t *repr);
+
 // used to initialized your handshakeState with a handshake pattern
 void disco_Initialize(handshakeState *hs, const char *handshake_pattern,
                       bool initiator, uint8_t *prologue, size_t prologue_len,
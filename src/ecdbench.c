@@ -0,0 +1,1047 @@
+#include <stddef.h>  // for NULL
+#include "ecdparam.h"
+
+
+// Parameters of the benchmark-only curves of ecdparam.h (generated by
+// gen_param). They are not part of the library; only the test and benchmark
+// programs compile this file, with MSPECC_BENCH_CURVES defined.
+#ifndef MSPECC_BENCH_CURVES
+#error "ecdbench.c must be compiled with MSPECC_BENCH_CURVES!"
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+#if (WSIZE == 16) // CURVE PARAMETERS REPRESENTED WITH 16-BIT WORDS ///////////
+///////////////////////////////////////////////////////////////////////////////
+
+// p = 2^159 - 91, (A+2)/4 = 797892, B = 2 (generated by gen_param)
+
+static const Word crvp159_a24[2] = { 0x2cc4, 0x000c };
+
+static const Word crvp159_dte[160/WSIZE] = {                                      \
+  0x4044, 0x4be2, 0xd788, 0x4aeb, 0x91d6, 0xf4ad, 0x6055, 0xc548, 0x4037, 0x0eaa };
+
+static const Word crvp159_rma[160/WSIZE] = {                                      \
+  0x85f4, 0x6bce, 0xccec, 0x3d7c, 0x2c87, 0x7c34, 0x06f2, 0x6284, 0x81de, 0x2172 };
+
+static const Word crvp159_rm1[160/WSIZE] = {                                      \
+  0x3d57, 0xb807, 0xdee9, 0xfb9c, 0x87e8, 0x1558, 0xcd11, 0xacfa, 0xbd09, 0x1f2d };
+
+static const Word crvp159_tbl[16*3*(160/WSIZE)] = {                               \
+  /* Point P00 = [0 + 0*(2^40) + 0*(2^80) + 0*(2^120)]*G */                       \
+  0xffd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0xffd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, \
+  /* Point P01 = [1 + 0*(2^40) + 0*(2^80) + 0*(2^120)]*G */                       \
+  0x72e6, 0x65ef, 0x35a9, 0xf3ec, 0xbe36, 0x0fdc, 0x33de, 0xeccc, 0xe17e, 0x3d7a, \
+  0x4470, 0xac86, 0x6432, 0xcb3a, 0xa4b0, 0x4bab, 0x7cc8, 0xedbf, 0x3830, 0x68ec, \
+  0x29e5, 0xe21b, 0xfb45, 0xc617, 0x68ef, 0x06c2, 0xd774, 0x2774, 0x929f, 0x081b, \
+  /* Point P02 = [0 + 1*(2^40) + 0*(2^80) + 0*(2^120)]*G */                       \
+  0x5532, 0x4918, 0x58fb, 0xde27, 0x6ead, 0x7959, 0xd254, 0x3137, 0x6706, 0x5b26, \
+  0x66f7, 0x6448, 0x1153, 0xdac1, 0x953a, 0x3d72, 0x1c67, 0xaff5, 0x2eb6, 0x787e, \
+  0x8d6c, 0xbba6, 0x50a1, 0x9140, 0x3b07, 0x9d22, 0x5c3a, 0x0f92, 0xd7eb, 0x7cad, \
+  /* Point P03 = [1 + 1*(2^40) + 0*(2^80) + 0*(2^120)]*G */                       \
+  0x4abc, 0x9301, 0xcfce, 0xb9fa, 0xfe88, 0x7895, 0x830a, 0x9d4f, 0x1c3a, 0x05b5, \
+  0x78af, 0xc31c, 0x847c, 0x3501, 0xbc0e, 0x1748, 0xce26, 0xde78, 0xba2b, 0x5ea5, \
+  0x8a88, 0x4bc8, 0xbf79, 0x6152, 0x06d5, 0x4279, 0x6121, 0x3627, 0x08a0, 0x54ad, \
+  /* Point P04 = [0 + 0*(2^40) + 1*(2^80) + 0*(2^120)]*G */                       \
+  0xfd5d, 0x3e5d, 0x57f3, 0x840e, 0x1187, 0x3ad3, 0x9a41, 0xc84b, 0xb963, 0x4e4a, \
+  0x08c4, 0xd1f1, 0xc25b, 0xf680, 0xbd9f, 0x6c51, 0xfa4d, 0xe88b, 0x43ed, 0x53fc, \
+  0xe365, 0x651e, 0x4b73, 0xd0f7, 0x8a95, 0x2329, 0xc99b, 0x9310, 0x873c, 0x2955, \
+  /* Point P05 = [1 + 0*(2^40) + 1*(2^80) + 0*(2^120)]*G */                       \
+  0x1713, 0x71f6, 0x0fa8, 0x4c6f, 0xa8c1, 0xabec, 0x9264, 0xb985, 0x286b, 0x455e, \
+  0x9122, 0xaf85, 0x701c, 0xce55, 0xde66, 0x2cc2, 0x494c, 0xe3b0, 0xf331, 0x6f04, \
+  0xcdd2, 0x068e, 0x7ee9, 0x0431, 0x5fd9, 0xfa48, 0x072a, 0x52b7, 0x85e0, 0x2462, \
+  /* Point P06 = [0 + 1*(2^40) + 1*(2^80) + 0*(2^120)]*G */                       \
+  0xf2b9, 0xdbd7, 0xf845, 0x1e27, 0xd14a, 0x6ee3, 0x3974, 0x7310, 0x09f0, 0x1fb6, \
+  0x9069, 0x30ef, 0xa25e, 0xeadb, 0xa571, 0x630b, 0x6ffe, 0x5bc5, 0x3bb3, 0x64de, \
+  0xbe95, 0x6976, 0xdd84, 0x615c, 0xe9fe, 0xad07, 0x9d2d, 0x8571, 0x6dba, 0x4a59, \
+  /* Point P07 = [1 + 1*(2^40) + 1*(2^80) + 0*(2^120)]*G */                       \
+  0x38db, 0xa373, 0x82d3, 0x3fa8, 0x6b0f, 0x9dba, 0x2657, 0xdae9, 0xb481, 0x5103, \
+  0xb495, 0x4249, 0xbc67, 0xa329, 0x0b94, 0x0223, 0x6f0b, 0x1f08, 0xfe5f, 0x3f68, \
+  0x100e, 0xed1b, 0xfda8, 0x35cd, 0x4948, 0x11be, 0x9088, 0xf2a6, 0xac2b, 0x21a0, \
+  /* Point P08 = [0 + 0*(2^40) + 0*(2^80) + 1*(2^120)]*G */                       \
+  0x03f9, 0xcf0e, 0x40aa, 0x2119, 0x4bd8, 0x9347, 0xf07b, 0x5574, 0x2058, 0x29f1, \
+  0x7be2, 0x0b38, 0xd144, 0x1dae, 0x62e7, 0x8038, 0x39c5, 0xd0b3, 0x0360, 0x4fbb, \
+  0x4c20, 0x350f, 0x489c, 0x1ab8, 0x756a, 0x6c36, 0xf25e, 0xb6ca, 0x3786, 0x34c6, \
+  /* Point P09 = [1 + 0*(2^40) + 0*(2^80) + 1*(2^120)]*G */                       \
+  0xbf75, 0x30d9, 0x0c3d, 0x84e0, 0x09b7, 0x8df7, 0xf206, 0x539b, 0x0d29, 0x1786, \
+  0x6686, 0xe1da, 0x0515, 0x5882, 0x2672, 0x6338, 0x56ca, 0x85a4, 0x269d, 0x3f7d, \
+  0x7472, 0x14e1, 0x6a39, 0x65ea, 0x9810, 0x9b32, 0x3e70, 0x1c5c, 0x2623, 0x09cc, \
+  /* Point P10 = [0 + 1*(2^40) + 0*(2^80) + 1*(2^120)]*G */                       \
+  0x01e9, 0xe260, 0x4d88, 0x45be, 0x9c32, 0x678e, 0x96bd, 0x3ec8, 0x14d4, 0x10b6, \
+  0x8d04, 0x1f26, 0xf5c4, 0x3f7b, 0xb15d, 0xdffe, 0xa488, 0xaa6f, 0xb701, 0x6620, \
+  0x315d, 0xe873, 0x3c32, 0xf6fb, 0x2a6e, 0xd6ef, 0x6ace, 0x1972, 0xbd04, 0x4e1f, \
+  /* Point P11 = [1 + 1*(2^40) + 0*(2^80) + 1*(2^120)]*G */                       \
+  0x2718, 0x494f, 0x7c1b, 0x6f30, 0x8bbb, 0x3af8, 0x172f, 0x2bb1, 0x77f4, 0x7410, \
+  0x1d5f, 0x82b1, 0x4883, 0xe78a, 0x6e20, 0xee4e, 0xa24a, 0xdb80, 0x15e1, 0x4a2a, \
+  0xd8b9, 0x6753, 0xd3eb, 0xa383, 0xd2a7, 0x5b0d, 0xe495, 0x42b0, 0xca1f, 0x247b, \
+  /* Point P12 = [0 + 0*(2^40) + 1*(2^80) + 1*(2^120)]*G */                       \
+  0x0dd4, 0x5fd8, 0x2d90, 0xcc8d, 0xf283, 0xa74a, 0x97c5, 0x1c7e, 0x073c, 0x18b7, \
+  0xff94, 0x8903, 0x138e, 0xc9b1, 0xf07f, 0x6ea7, 0x7405, 0x82c2, 0xaab5, 0x77a2, \
+  0xc5a5, 0x5326, 0x9bbf, 0x779d, 0x5d70, 0x6f50, 0xd836, 0x361b, 0x813f, 0x54b0, \
+  /* Point P13 = [1 + 0*(2^40) + 1*(2^80) + 1*(2^120)]*G */                       \
+  0x8a87, 0x36f5, 0xa296, 0x06b3, 0x247f, 0x0852, 0xb07e, 0xf0a2, 0x8639, 0x0f56, \
+  0x437e, 0x3dc2, 0x8097, 0x0589, 0x68c1, 0x98ff, 0xd7b5, 0x9493, 0xbea4, 0x1e35, \
+  0x2bb7, 0xc0a1, 0xa024, 0x17e6, 0xbc88, 0xdc92, 0x4c10, 0xfb18, 0x1f13, 0x6e8e, \
+  /* Point P14 = [0 + 1*(2^40) + 1*(2^80) + 1*(2^120)]*G */                       \
+  0xf32c, 0x2511, 0xa6dc, 0xf47a, 0xa46c, 0x0621, 0x2219, 0x0286, 0xaa48, 0x6ae0, \
+  0xde43, 0xc06b, 0x73c4, 0x4541, 0x62ad, 0xa3fc, 0x88dc, 0xd21c, 0x806a, 0x3756, \
+  0xd262, 0x3aa4, 0x0b8f, 0x30c1, 0x734f, 0xbfc0, 0xbb80, 0xe3d3, 0x2ed7, 0x28f4, \
+  /* Point P15 = [1 + 1*(2^40) + 1*(2^80) + 1*(2^120)]*G */                       \
+  0x55e8, 0xd2e7, 0x6407, 0xafc7, 0x1b6d, 0xfc39, 0x117d, 0x5c9f, 0x6128, 0x2aac, \
+  0x6cf6, 0x2ba8, 0x322b, 0x6df0, 0x5033, 0xdf99, 0x9727, 0xf5ce, 0xa90b, 0x3d20, \
+  0x7552, 0xb154, 0xf2c7, 0xc2ae, 0xa78f, 0xfd66, 0x5971, 0xfa84, 0x4636, 0x2f72 };
+
+const ECDPARAM CURVE_P159 = {
+  10,
+  91,
+  crvp159_a24,
+  crvp159_dte,
+  crvp159_rma,
+  crvp159_rm1,
+  crvp159_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^191 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp191_a24[2] = { 0x0003, 0x0000 };
+
+static const Word crvp191_dte[192/WSIZE] = {                                                      \
+  0x5548, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555 };
+
+static const Word crvp191_rma[192/WSIZE] = {                                                      \
+  0xe354, 0x9ca4, 0x1451, 0x2c6d, 0xa597, 0x64ff, 0x6df7, 0x87d6, 0x9e49, 0x4988, 0xd922, 0x6cd2 };
+
+static const Word crvp191_rm1[192/WSIZE] = {                                                      \
+  0xb635, 0x2231, 0x9efa, 0xbd7e, 0x0b5c, 0x6cf8, 0x9a3a, 0xea18, 0xd61c, 0x2847, 0x7b81, 0x6709 };
+
+static const Word crvp191_tbl[16*3*(192/WSIZE)] = {                                               \
+  /* Point P00 = [0 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */                                       \
+  0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, \
+  /* Point P01 = [1 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */                                       \
+  0xa7d2, 0xcfa8, 0x34d3, 0x179e, 0xc71c, 0xa791, 0xe038, 0x27fc, 0x3696, 0x9ba5, 0xe6e0, 0x4057, \
+  0x0609, 0xcc6b, 0xf089, 0x3876, 0xee2b, 0xebfd, 0x6037, 0xa7d1, 0xfec1, 0xbf2a, 0x0d8c, 0x210a, \
+  0xb81c, 0x276b, 0x7432, 0xddc1, 0xf930, 0x8dc2, 0x49e0, 0x43dd, 0x9bd2, 0x9f24, 0xf920, 0x7ad7, \
+  /* Point P02 = [0 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */                                       \
+  0xbcfc, 0xe16d, 0x00e2, 0x4821, 0x2114, 0x305f, 0x68d6, 0x766a, 0x4278, 0x4ad9, 0xe063, 0x1f1a, \
+  0xda18, 0x74d6, 0xef96, 0x6b69, 0xc627, 0xee86, 0x8c0e, 0x1ade, 0x4317, 0x5811, 0x6ff1, 0x0e05, \
+  0x16b4, 0x8bdf, 0xf1db, 0xe00c, 0x1047, 0x1ea8, 0x511f, 0xc02c, 0x7ad6, 0x5af2, 0xf77f, 0x6e36, \
+  /* Point P03 = [1 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */                                       \
+  0x093f, 0xa0bf, 0xded8, 0x5140, 0x360a, 0xec1c, 0x576d, 0xa7d1, 0x1f42, 0x6cd3, 0x5be4, 0x5cdb, \
+  0x9b79, 0xc807, 0xd009, 0x9a87, 0x431f, 0xadc5, 0xaffb, 0xd2cf, 0xdda4, 0x35ba, 0x6c7f, 0x36cc, \
+  0x2e59, 0x2eb6, 0xb8e5, 0xb76f, 0xbc19, 0x6c0a, 0x14a7, 0x40e2, 0x8153, 0xe10c, 0xfa3a, 0x6472, \
+  /* Point P04 = [0 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */                                       \
+  0x5944, 0x928c, 0x1adb, 0x3c77, 0xbf82, 0x7d05, 0x170a, 0xed7f, 0xfa43, 0xcc93, 0x7bd9, 0x79bb, \
+  0xa789, 0x46b0, 0x5102, 0x1cd9, 0x5fae, 0x7996, 0xf5fc, 0x3667, 0x401c, 0x9be7, 0x1454, 0x3df3, \
+  0x1813, 0x783b, 0xed04, 0xd8db, 0x62ce, 0xdd65, 0xe274, 0x2b54, 0xa935, 0x3963, 0x2fce, 0x2afd, \
+  /* Point P05 = [1 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */                                       \
+  0x8653, 0xc307, 0x20e7, 0x0b08, 0xa7a3, 0x9112, 0xd6de, 0x86ff, 0x5670, 0x40a1, 0x4938, 0x1236, \
+  0xcd34, 0x6f83, 0xd438, 0x0f5b, 0xd9e4, 0x2ba4, 0x935a, 0xc15f, 0x3941, 0x31be, 0xa8a2, 0x3dd5, \
+  0x4bf4, 0x755f, 0x8236, 0x9854, 0xda21, 0x4b8a, 0x59e2, 0xe776, 0x023a, 0xb9a7, 0x94d4, 0x7c28, \
+  /* Point P06 = [0 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */                                       \
+  0x9f55, 0xfcd1, 0x1927, 0x2936, 0x7ed4, 0x8c89, 0x817c, 0x27bc, 0x7d79, 0x8686, 0x56f4, 0x28c5, \
+  0x3919, 0x0375, 0x84f4, 0xea25, 0x0132, 0x7458, 0x16a7, 0xe8ea, 0xf0b4, 0xb03c, 0x5f35, 0x2a1f, \
+  0x6b97, 0x590e, 0xb16c, 0xf23c, 0x2c82, 0xf4dc, 0xf2e4, 0x6000, 0x21e5, 0xcabb, 0x8ce4, 0x3c13, \
+  /* Point P07 = [1 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */                                       \
+  0xfbec, 0xc795, 0xe2dc, 0xdec6, 0x0cd5, 0x183c, 0x6939, 0xccd8, 0xa86c, 0xf266, 0x5fe5, 0x3ace, \
+  0x7ffc, 0x235a, 0xe2bd, 0xc989, 0x5e28, 0x9d67, 0x8a2d, 0x6825, 0xe3c2, 0x088b, 0xdf6d, 0x1db1, \
+  0xeeeb, 0x8c54, 0x45af, 0xac83, 0x0406, 0x1ee6, 0xd0f4, 0x611e, 0x1691, 0x6479, 0xf3ee, 0x68f9, \
+  /* Point P08 = [0 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */                                       \
+  0xd624, 0xdcb8, 0xdf38, 0x2f82, 0xfbfc, 0xebef, 0x4d70, 0xc400, 0x5564, 0x5855, 0x6d74, 0x4335, \
+  0x5fcb, 0xaecb, 0x0293, 0xa2be, 0x6f57, 0xfccc, 0x6e13, 0xe495, 0xf3bb, 0xdff8, 0xd335, 0x1031, \
+  0xe768, 0x6ee3, 0xb8fa, 0x77e3, 0xffbb, 0x9be5, 0x80fc, 0xbc76, 0x8fcd, 0x384c, 0x483c, 0x2af8, \
+  /* Point P09 = [1 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */                                       \
+  0x5633, 0x5484, 0xb9d9, 0xbe46, 0x74db, 0x4c85, 0x87a0, 0xa00b, 0x0d80, 0x88c9, 0x41f5, 0x4b01, \
+  0xa1f7, 0x3905, 0x3e79, 0x1a51, 0x325f, 0x6aef, 0x8ddc, 0x482a, 0x9152, 0x92b8, 0xe755, 0x763e, \
+  0xabc2, 0xe22c, 0x882e, 0x079d, 0xa637, 0x1749, 0x6dd3, 0x4093, 0x6a71, 0xd252, 0x8ce7, 0x03c3, \
+  /* Point P10 = [0 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */                                       \
+  0xd695, 0x2937, 0x8838, 0xbe74, 0xc418, 0xa853, 0xe768, 0x6b74, 0xf001, 0x94e8, 0xd394, 0x1b0d, \
+  0x6486, 0xa7b3, 0xcf89, 0xc021, 0x7df7, 0x18f2, 0xafd6, 0xfe12, 0xf8fd, 0x22bf, 0x8a8a, 0x6175, \
+  0xd2a5, 0x8d71, 0xb2c8, 0xbca2, 0xcc45, 0x5120, 0xa255, 0x66f5, 0x7af0, 0xfc98, 0x4a27, 0x6215, \
+  /* Point P11 = [1 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */                                       \
+  0xcd43, 0xab1b, 0xbaf5, 0x30df, 0xd7ea, 0xf122, 0xdddc, 0x7d33, 0x2b20, 0x2d8a, 0xcb50, 0x66d9, \
+  0xe47b, 0x0e18, 0xbb92, 0x8625, 0x7470, 0x0abe, 0x8eeb, 0xb1f5, 0x7bc0, 0x9377, 0xbedb, 0x07bd, \
+  0x982a, 0x3a96, 0xe97e, 0x6563, 0x48cf, 0x5abd, 0x62ff, 0xc9f7, 0x0022, 0xcf65, 0x973f, 0x769d, \
+  /* Point P12 = [0 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */                                       \
+  0x0fcf, 0xc8a5, 0xfa11, 0xa3f8, 0x92ba, 0x96b9, 0x478b, 0x4098, 0xb7b2, 0x700d, 0x0ed5, 0x69fa, \
+  0x9242, 0xa29c, 0xfcb0, 0xd582, 0x6539, 0x57ef, 0xfdb3, 0xa016, 0x7fd9, 0x022a, 0xf8f7, 0x7ca6, \
+  0x2733, 0xd8b1, 0xd8fc, 0xb612, 0xf160, 0x865b, 0xe42b, 0x0a13, 0x2045, 0x2f07, 0x8122, 0x5457, \
+  /* Point P13 = [1 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */                                       \
+  0xaa17, 0xf756, 0x7151, 0x6c89, 0x4ed6, 0x5c78, 0x19e9, 0xb993, 0xf88a, 0x8987, 0x1708, 0x1239, \
+  0xa80d, 0xc69f, 0x7459, 0xc319, 0x1712, 0x9024, 0x2891, 0xb87e, 0xaffa, 0xcea4, 0x63e9, 0x4953, \
+  0xc775, 0xfbcb, 0x1d92, 0x3bde, 0xdf8a, 0x45c2, 0xc2c0, 0x1b4d, 0x4ceb, 0x4b3a, 0x75fd, 0x1249, \
+  /* Point P14 = [0 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */                                       \
+  0xe07c, 0x1c6d, 0xf72e, 0x375b, 0x1a7b, 0x832e, 0x9752, 0x4792, 0x0be7, 0x9ec7, 0xccd2, 0x6f79, \
+  0x523a, 0x67ae, 0xd42a, 0x1e5c, 0x2fc2, 0xd6a5, 0x5f5e, 0xe8c5, 0x696a, 0x0bd9, 0x2efe, 0x7408, \
+  0xedce, 0x0959, 0x69f9, 0xbfa7, 0xce5d, 0x4bee, 0xa8eb, 0x6b93, 0x32de, 0xbfd8, 0xb1ce, 0x39cc, \
+  /* Point P15 = [1 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */                                       \
+  0x5c78, 0x0d2b, 0x161a, 0xbc2c, 0x5578, 0x245a, 0x9124, 0xc302, 0xac84, 0x6026, 0x3f80, 0x5873, \
+  0x41ba, 0x2580, 0xe22a, 0x4f57, 0x9413, 0xcc28, 0x3752, 0xcca8, 0x2f90, 0xc044, 0xe90b, 0x0055, \
+  0xf783, 0xa600, 0x12a9, 0xeca6, 0x6014, 0x4341, 0xaca7, 0x4672, 0x444a, 0xf7fc, 0x58f1, 0x6831 };
+
+const ECDPARAM CURVE_P191 = {
+  12,
+  19,
+  crvp191_a24,
+  crvp191_dte,
+  crvp191_rma,
+  crvp191_rm1,
+  crvp191_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^207 - 91, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crv20791_a24[2] = { 0x0003, 0x0000 };
+
+static const Word crv20791_dte[208/WSIZE] = {                                                             \
+  0x5518, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555 };
+
+static const Word crv20791_rma[208/WSIZE] = {                                                             \
+  0x4449, 0xefad, 0x8748, 0x1c1e, 0xb633, 0x6117, 0xc495, 0xa73e, 0x18f0, 0xa7ba, 0x3b37, 0x5e7d, 0x55b7 };
+
+static const Word crv20791_rm1[208/WSIZE] = {                                                             \
+  0x7a7e, 0xb98c, 0xe974, 0x5188, 0xdec0, 0x557e, 0x10df, 0x2227, 0x910f, 0x412c, 0xa706, 0x87fa, 0x5809 };
+
+static const Word crv20791_tbl[16*3*(208/WSIZE)] = {                                                      \
+  /* Point P00 = [0 + 0*(2^52) + 0*(2^104) + 0*(2^156)]*G */                                              \
+  0xffd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0xffd3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, \
+  /* Point P01 = [1 + 0*(2^52) + 0*(2^104) + 0*(2^156)]*G */                                              \
+  0xddac, 0x8a84, 0xe4ce, 0x7987, 0x2e51, 0x1bd8, 0x25de, 0xd246, 0x0765, 0x1b4e, 0xec82, 0xc6be, 0x224c, \
+  0xddd2, 0xe236, 0xd1f4, 0x1264, 0xee93, 0x62cf, 0x056c, 0xd4c5, 0x6ab8, 0x5b90, 0xa000, 0xe7ce, 0x61dc, \
+  0x0d69, 0xa4d1, 0xe0fb, 0xcf0c, 0xa97d, 0xf578, 0x70bb, 0x22c8, 0x24f5, 0x826f, 0x027e, 0xadc7, 0x49af, \
+  /* Point P02 = [0 + 1*(2^52) + 0*(2^104) + 0*(2^156)]*G */                                              \
+  0xbe2d, 0xd8d7, 0x2a9a, 0x220d, 0x01d5, 0xdd17, 0x4ebe, 0x87d9, 0x84ad, 0x169c, 0x788f, 0x60cc, 0x1c08, \
+  0x5db8, 0x0036, 0x62dd, 0x79b1, 0x4d78, 0x7480, 0x6458, 0x8897, 0x7f0b, 0x450b, 0x3fb3, 0xb21c, 0x68d8, \
+  0x5c42, 0xa4fa, 0xa381, 0xaff9, 0x366a, 0x97c8, 0xa75b, 0x8658, 0xc640, 0xa28f, 0x93de, 0x6fcd, 0x08ca, \
+  /* Point P03 = [1 + 1*(2^52) + 0*(2^104) + 0*(2^156)]*G */                                              \
+  0x15f4, 0x01f8, 0x3cbd, 0x9d3d, 0x9b9f, 0xaa35, 0x453a, 0xfa9f, 0x898f, 0x2838, 0x4a04, 0xe73c, 0x1c28, \
+  0x790f, 0x99bd, 0x39d1, 0xac22, 0x1619, 0xf5b9, 0x4c74, 0x54d1, 0xc932, 0xeb9a, 0x5f77, 0x502a, 0x5fd4, \
+  0x5181, 0x4b87, 0xa104, 0x9bac, 0x2e3e, 0x4e6d, 0x4696, 0xcbb1, 0x2d7c, 0x8143, 0x4884, 0x432d, 0x11ff, \
+  /* Point P04 = [0 + 0*(2^52) + 1*(2^104) + 0*(2^156)]*G */                                              \
+  0xa324, 0xbbc3, 0xac2e, 0x288c, 0xee8d, 0x84ef, 0xaea0, 0x5bac, 0x32b9, 0x9b62, 0x7088, 0x375e, 0x11c0, \
+  0xa599, 0x6717, 0x58c9, 0x3864, 0x512b, 0xb9d6, 0x08a9, 0x5058, 0xbbc9, 0x8b8a, 0xa921, 0x4869, 0x6e78, \
+  0x2011, 0xdf66, 0x0da5, 0xaf14, 0x9670, 0x9893, 0xdb5d, 0xefa8, 0xd0a0, 0x0aec, 0x5084, 0x86ca, 0x43f3, \
+  /* Point P05 = [1 + 0*(2^52) + 1*(2^104) + 0*(2^156)]*G */                                              \
+  0x7dc4, 0x43d6, 0x74d5, 0x1855, 0x47c8, 0xeffb, 0x3e35, 0x2607, 0x543b, 0x4c8f, 0x2f55, 0xea5b, 0x1e0e, \
+  0x883f, 0xd8be, 0x3da4, 0xcb97, 0x78aa, 0x2962, 0x28a6, 0xcab9, 0xfb0a, 0xd7ae, 0x6aed, 0x1be0, 0x3cf0, \
+  0x8343, 0xf5b5, 0x6df2, 0x328b, 0xc3b5, 0x290a, 0x2809, 0x89e0, 0x3e27, 0x020a, 0x6da6, 0x71f3, 0x293e, \
+  /* Point P06 = [0 + 1*(2^52) + 1*(2^104) + 0*(2^156)]*G */                                              \
+  0x8583, 0x5f5f, 0x5c11, 0x13fc, 0x0a90, 0x7908, 0xa6ee, 0x7fa3, 0x116a, 0xddef, 0x8c7a, 0xd0cc, 0x5f2b, \
+  0xdb00, 0x936a, 0x9aad, 0x2c44, 0x7552, 0x588f, 0x17e9, 0x9c1b, 0xd057, 0x6e4b, 0xfb35, 0x134f, 0x5519, \
+  0x7aa5, 0xeb60, 0xc14e, 0x43e6, 0x7350, 0xc401, 0x68c8, 0xb179, 0x876d, 0xd60e, 0x09d7, 0x5348, 0x521a, \
+  /* Point P07 = [1 + 1*(2^52) + 1*(2^104) + 0*(2^156)]*G */                                              \
+  0x501e, 0xce49, 0x976f, 0xe95a, 0xd246, 0xb4e5, 0xf0ba, 0xb05b, 0xd705, 0x2de7, 0x88cb, 0xc7a9, 0x17e5, \
+  0xecee, 0xb650, 0xe159, 0xef8b, 0x05e2, 0xafdc, 0x0e00, 0x70c4, 0x831e, 0xa872, 0xe5df, 0xc7aa, 0x637b, \
+  0xa635, 0x9535, 0xc856, 0xd7df, 0xe564, 0x3388, 0xa347, 0x9adb, 0xb4c4, 0x7f3b, 0x5b0f, 0x76db, 0x3d82, \
+  /* Point P08 = [0 + 0*(2^52) + 0*(2^104) + 1*(2^156)]*G */                                              \
+  0x2cf2, 0x32cf, 0x2e71, 0xa70d, 0xed81, 0xab6c, 0x5a63, 0x579b, 0x0b27, 0x702c, 0x626b, 0xd38b, 0x69a9, \
+  0xfed1, 0x90d7, 0x5868, 0x1ee1, 0xe381, 0x74bc, 0x45ea, 0x6136, 0xc266, 0x0d6f, 0x5009, 0x4c66, 0x7b0c, \
+  0x56e4, 0xaf83, 0x77f3, 0x7f79, 0xd8d4, 0x9c6a, 0x98e8, 0x696a, 0x92d4, 0x7f54, 0xc46f, 0xfc77, 0x47c4, \
+  /* Point P09 = [1 + 0*(2^52) + 0*(2^104) + 1*(2^156)]*G */                                              \
+  0x35b8, 0x8543, 0xdb04, 0x54fa, 0xb46d, 0x8d62, 0x0071, 0x27ec, 0xaa46, 0xdf04, 0x9f4d, 0xe223, 0x1365, \
+  0xac00, 0x1662, 0x11c6, 0xcdce, 0xd571, 0x15ac, 0xf56e, 0xa232, 0x24bd, 0x6f6d, 0x0e7e, 0xef16, 0x68f6, \
+  0x1573, 0x9572, 0xa9c2, 0x9b55, 0xe97b, 0x3753, 0x1858, 0x0d00, 0xceff, 0x019b, 0x6a04, 0x8095, 0x1962, \
+  /* Point P10 = [0 + 1*(2^52) + 0*(2^104) + 1*(2^156)]*G */                                              \
+  0xf13f, 0xe34b, 0x60bb, 0x17c2, 0xb671, 0x2531, 0x2f28, 0xa678, 0x8bdc, 0x9562, 0x07de, 0xd99b, 0x520b, \
+  0x52b7, 0x273c, 0x4199, 0xcbaf, 0x3118, 0xee00, 0xbeb9, 0x1df6, 0xf408, 0x3c0e, 0x0167, 0x83cc, 0x48ac, \
+  0xa36e, 0x42cc, 0x6ff3, 0x0c9b, 0x28fa, 0x3c54, 0x9539, 0x5cad, 0xba9b, 0xb076, 0x8586, 0xd861, 0x4fa0, \
+  /* Point P11 = [1 + 1*(2^52) + 0*(2^104) + 1*(2^156)]*G */                                              \
+  0xc7b6, 0x19c8, 0xd965, 0x03a9, 0x3af4, 0xf3fc, 0x17c0, 0x70c4, 0x1d0a, 0x85eb, 0xbf9d, 0x0f2b, 0x3977, \
+  0x2cdd, 0xdb73, 0x3d96, 0xcfa9, 0xeaa9, 0x08c4, 0xa0e5, 0xc609, 0xf24c, 0x8b02, 0x7725, 0x0f2b, 0x5e89, \
+  0x4789, 0xc2f0, 0xbbdb, 0x37fb, 0xaeef, 0xa7b3, 0xabae, 0x7a83, 0xda78, 0x82c5, 0x7848, 0x2481, 0x19a6, \
+  /* Point P12 = [0 + 0*(2^52) + 1*(2^104) + 1*(2^156)]*G */                                              \
+  0x7aad, 0x3d8b, 0xbecb, 0xa974, 0x7187, 0x733c, 0xdfb2, 0x17d3, 0x7c8f, 0x7f63, 0x52e8, 0x06fe, 0x2fe3, \
+  0x1e62, 0x97d2, 0xd7f8, 0x61f5, 0xf8ee, 0x64e0, 0xc709, 0xbd2c, 0xe152, 0x2291, 0xfbda, 0xba9f, 0x005d, \
+  0xd000, 0x9864, 0xc2ea, 0x51e8, 0x4193, 0x8796, 0xf70a, 0xfed9, 0x769a, 0x7273, 0x90cb, 0xaa00, 0x5efa, \
+  /* Point P13 = [1 + 0*(2^52) + 1*(2^104) + 1*(2^156)]*G */                                              \
+  0x0dc1, 0x80f9, 0xe66a, 0x3686, 0xf201, 0x5f54, 0xf0d4, 0xf242, 0xafeb, 0x3cfb, 0x9823, 0x6ab0, 0x4afa, \
+  0xf441, 0x8d17, 0x3fe6, 0xdbc2, 0x9641, 0x4623, 0x785b, 0xc7ef, 0xdac1, 0xaaea, 0x1e47, 0xf66c, 0x17cc, \
+  0x0d14, 0x7bc0, 0xed01, 0xd384, 0x6835, 0x1e65, 0xdeec, 0xbb6e, 0x3752, 0x198b, 0xa7e7, 0x8944, 0x70fa, \
+  /* Point P14 = [0 + 1*(2^52) + 1*(2^104) + 1*(2^156)]*G */                                              \
+  0x9f68, 0xecad, 0x7fc7, 0x80b0, 0x5880, 0x800e, 0x6950, 0x0712, 0x7ad5, 0x282a, 0xaad0, 0x6255, 0x208e, \
+  0xa671, 0x6bcc, 0x2041, 0xa9aa, 0x689c, 0x2338, 0x11fd, 0xfbd2, 0x8a11, 0xa4e0, 0xbf6f, 0x32b2, 0x6aad, \
+  0x5f5a, 0x3b71, 0x832e, 0x8e2f, 0x015b, 0x2ebd, 0xbcdb, 0xefbd, 0x182b, 0x6fb2, 0xcf5b, 0x405c, 0x187e, \
+  /* Point P15 = [1 + 1*(2^52) + 1*(2^104) + 1*(2^156)]*G */                                              \
+  0x8e1f, 0xf5b9, 0x8ef9, 0x784a, 0xe739, 0x3b0e, 0x9ad4, 0x9546, 0x098a, 0x59f8, 0x42e5, 0xba9c, 0x50fc, \
+  0x6db1, 0x5229, 0x0672, 0xff13, 0x0823, 0xb048, 0x9503, 0x57d3, 0x1ea1, 0xadf3, 0xe378, 0x64c3, 0x5b08, \
+  0x4e69, 0x3576, 0x000d, 0x297f, 0xa583, 0xe663, 0x1af9, 0x29bc, 0xcaf1, 0xe130, 0x9419, 0x8500, 0x1b02 };
+
+const ECDPARAM CURVE20791 = {
+  13,
+  91,
+  crv20791_a24,
+  crv20791_dte,
+  crv20791_rma,
+  crv20791_rm1,
+  crv20791_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^223 - 235, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp223_a24[2] = { 0x0003, 0x0000 };
+
+static const Word crvp223_dte[224/WSIZE] = {                                                                      \
+  0x54b8, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555 };
+
+static const Word crvp223_rma[224/WSIZE] = {                                                                      \
+  0x9e96, 0x55c0, 0xf38a, 0xfd70, 0x103c, 0x5591, 0x2158, 0xeed0, 0x0e38, 0xbe60, 0x284b, 0x5a3a, 0x21d3, 0x1a99 };
+
+static const Word crvp223_rm1[224/WSIZE] = {                                                                      \
+  0xacd2, 0xe913, 0xb356, 0xa479, 0xf658, 0xf73f, 0xd1f2, 0xb896, 0xfacf, 0xdfb4, 0xabae, 0x2c96, 0xdb56, 0x2917 };
+
+static const Word crvp223_tbl[16*3*(224/WSIZE)] = {                                                               \
+  /* Point P00 = [0 + 0*(2^56) + 0*(2^112) + 0*(2^168)]*G */                                                      \
+  0xff8b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0xff8b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, \
+  /* Point P01 = [1 + 0*(2^56) + 0*(2^112) + 0*(2^168)]*G */                                                      \
+  0xfb2f, 0x5eb1, 0x0c01, 0x5ce8, 0xb763, 0xe062, 0xa1b6, 0x82c6, 0x29fa, 0xbda1, 0xa3c9, 0xf36a, 0x829b, 0x14d9, \
+  0xe93a, 0xe3f9, 0x679d, 0x4279, 0x316a, 0xfe2a, 0xe250, 0x3787, 0xe102, 0x09cb, 0x729e, 0x46f6, 0x86b1, 0x3af0, \
+  0x104c, 0x484a, 0x788f, 0x325c, 0x2e76, 0x1c3a, 0x8121, 0xa184, 0x3f62, 0xdbf8, 0xbad1, 0x2adb, 0x9fc8, 0x643c, \
+  /* Point P02 = [0 + 1*(2^56) + 0*(2^112) + 0*(2^168)]*G */                                                      \
+  0xe981, 0xe4ab, 0x139a, 0xe133, 0x381d, 0xcb9a, 0x4dcf, 0xcd23, 0x19db, 0x780a, 0x941d, 0xd1f8, 0xffe8, 0x47d0, \
+  0x0a97, 0xfc1b, 0x59f8, 0x5ef9, 0x453f, 0xa57a, 0x42c8, 0xf0a1, 0xb135, 0xcdb2, 0x0fe7, 0x2792, 0x8aab, 0x6242, \
+  0x843e, 0x7935, 0x5766, 0x923c, 0x82c1, 0xd685, 0x983d, 0x23f4, 0x334f, 0x7101, 0x19f3, 0xa572, 0x60f9, 0x64fa, \
+  /* Point P03 = [1 + 1*(2^56) + 0*(2^112) + 0*(2^168)]*G */                                                      \
+  0x6c0c, 0x6033, 0xd124, 0xd533, 0x487b, 0x6b14, 0x5f34, 0xf21e, 0x175d, 0x2523, 0xb585, 0x5d67, 0x979b, 0x4959, \
+  0xea67, 0x7a5c, 0xa9ed, 0x5ec7, 0xbe88, 0xccdb, 0xd2d1, 0x2534, 0x1465, 0x0afe, 0xbd1b, 0xc614, 0xc9e4, 0x530f, \
+  0xc346, 0x6a02, 0x275c, 0x6524, 0xa83d, 0x70f2, 0xe405, 0x5065, 0xa2e2, 0x7352, 0x6508, 0xc2ef, 0x67fe, 0x19f4, \
+  /* Point P04 = [0 + 0*(2^56) + 1*(2^112) + 0*(2^168)]*G */                                                      \
+  0xda44, 0x65f3, 0x1ba6, 0x36c2, 0xaac6, 0x1d20, 0x1c1e, 0x9e8b, 0xcbe3, 0x710f, 0xc208, 0x783f, 0x258d, 0x5449, \
+  0x3140, 0xfb99, 0x249c, 0x1f04, 0x1a27, 0x3471, 0x285b, 0x2e27, 0x6d38, 0x5ea2, 0x83ab, 0xa6b0, 0x1998, 0x361c, \
+  0x3d24, 0xb23f, 0xf1e4, 0xe942, 0x08b2, 0x930d, 0xe6ef, 0x348d, 0x2f5a, 0x2fd2, 0x137a, 0xe3a0, 0xa0c8, 0x003c, \
+  /* Point P05 = [1 + 0*(2^56) + 1*(2^112) + 0*(2^168)]*G */                                                      \
+  0x44a6, 0x885a, 0x76da, 0x7b00, 0x5c5b, 0xda0f, 0xe3b2, 0x3755, 0x1c93, 0xb1bf, 0xed46, 0xd88f, 0xa2d2, 0x0888, \
+  0x53e0, 0x15da, 0xf16a, 0x3ac5, 0xa6de, 0x0f3d, 0xf775, 0x27e0, 0x1b6e, 0x4fb7, 0xd50b, 0xe569, 0x616e, 0x22d9, \
+  0x2972, 0x0a72, 0x4791, 0x9fa9, 0x3c99, 0x9bfd, 0xff03, 0x1905, 0xafea, 0x1e3e, 0xd2a5, 0xa15a, 0xd523, 0x4f88, \
+  /* Point P06 = [0 + 1*(2^56) + 1*(2^112) + 0*(2^168)]*G */                                                      \
+  0x299c, 0xd4b4, 0x1b47, 0xfc12, 0x407b, 0x96f1, 0x76e0, 0x4d56, 0x47ea, 0x4334, 0xfca6, 0x8d4c, 0xc137, 0x75cf, \
+  0x119e, 0xd37c, 0xcb11, 0xe069, 0xa1c7, 0x8015, 0x5518, 0x00fb, 0xe23f, 0x59ef, 0xd9b1, 0xdbea, 0xcbb1, 0x04fb, \
+  0xb16e, 0x6506, 0x71d5, 0x12ee, 0x37b7, 0x16b1, 0x65b8, 0x976a, 0xa557, 0xe36b, 0x990c, 0x426d, 0x4194, 0x6f73, \
+  /* Point P07 = [1 + 1*(2^56) + 1*(2^112) + 0*(2^168)]*G */                                                      \
+  0xde69, 0xfe35, 0x5793, 0x61d9, 0x31dd, 0x9543, 0x26b3, 0xb404, 0x76ab, 0x5260, 0xb2e8, 0x537e, 0x594e, 0x717c, \
+  0xec0d, 0xc1fb, 0x28f9, 0x555d, 0xd39a, 0xca02, 0xe89e, 0xbdd8, 0x2e1c, 0xe982, 0xd576, 0xf15d, 0x7ca0, 0x79dd, \
+  0x911a, 0x891a, 0x217a, 0xfe3d, 0x4e86, 0x0de7, 0x3ccc, 0x60c7, 0x9845, 0xfbe6, 0xb1d9, 0xde79, 0x389d, 0x01bf, \
+  /* Point P08 = [0 + 0*(2^56) + 0*(2^112) + 1*(2^168)]*G */                                                      \
+  0x2c27, 0x4e4b, 0x42dd, 0x9b30, 0xe2af, 0xabfe, 0x4c8c, 0xdfdf, 0x42a6, 0x03d6, 0x6916, 0xa940, 0xaabd, 0x2719, \
+  0x5882, 0xc831, 0xf625, 0xbebe, 0xb3b4, 0x9403, 0x5b69, 0x0f33, 0x1314, 0x6eb1, 0xe910, 0x1a0d, 0xe3c5, 0x1d58, \
+  0xecc6, 0x73bf, 0x31df, 0x3253, 0x04b2, 0x49fb, 0x6cb4, 0xbd45, 0xd32e, 0x3bd2, 0x3e92, 0xc8c3, 0x7d2d, 0x7d0a, \
+  /* Point P09 = [1 + 0*(2^56) + 0*(2^112) + 1*(2^168)]*G */                                                      \
+  0xd662, 0xcc3c, 0x86fb, 0x8bbe, 0x9852, 0xa0d3, 0xa455, 0xd3e5, 0xda76, 0x5a11, 0x4a34, 0x308a, 0x1105, 0x10c1, \
+  0xc4ba, 0x9a5d, 0x78a9, 0x9819, 0x746c, 0x9cfd, 0xaf0c, 0x8541, 0x6295, 0xd678, 0x4240, 0x9425, 0x6704, 0x41a8, \
+  0x038c, 0xb5ac, 0xce22, 0xd74d, 0x096b, 0x8eae, 0xbdf7, 0x7aae, 0x9b53, 0xcb55, 0x9def, 0x4102, 0x4ca2, 0x0b52, \
+  /* Point P10 = [0 + 1*(2^56) + 0*(2^112) + 1*(2^168)]*G */                                                      \
+  0x53a6, 0x6e1d, 0x2f36, 0x394f, 0x57f5, 0xf874, 0xd3ce, 0xccbd, 0x0520, 0xe7ad, 0xa10e, 0xaae5, 0xbf18, 0x35dc, \
+  0x4410, 0x687f, 0x5744, 0x9761, 0xc5fc, 0x352e, 0x254b, 0xa9a3, 0x073e, 0x50ed, 0xafc7, 0x9270, 0x6776, 0x361b, \
+  0x8406, 0x4d01, 0xdb3f, 0xb2a4, 0x0da9, 0x0e07, 0xa39f, 0xd1c8, 0xf586, 0x6453, 0x9b52, 0x14cf, 0xeab2, 0x0395, \
+  /* Point P11 = [1 + 1*(2^56) + 0*(2^112) + 1*(2^168)]*G */                                                      \
+  0x5b02, 0x351d, 0x109d, 0xb6e3, 0x7547, 0x5bc8, 0xefd9, 0xa94f, 0x5dd4, 0x3df6, 0xe7c8, 0x699b, 0x5451, 0x7844, \
+  0x8a8d, 0xcd27, 0x785b, 0x6d36, 0xd089, 0x8b31, 0x1251, 0x36ab, 0x01c8, 0xcf64, 0x2b0b, 0x810c, 0x8f0c, 0x6378, \
+  0x88d5, 0x3180, 0xd8f9, 0xf07f, 0x0af5, 0xefb1, 0x4a63, 0x6669, 0xc8b2, 0x175e, 0x303d, 0x481b, 0x3e18, 0x43c1, \
+  /* Point P12 = [0 + 0*(2^56) + 1*(2^112) + 1*(2^168)]*G */                                                      \
+  0x0419, 0x565f, 0x6ef7, 0xfe42, 0x66f9, 0x388b, 0x3d15, 0x0138, 0x4f96, 0xf19d, 0x35dc, 0xb09f, 0x9715, 0x6d11, \
+  0xbb05, 0xc93a, 0xc141, 0xa1f6, 0x3da5, 0x3828, 0x0d94, 0x64a9, 0x2165, 0xa4cb, 0x4dc7, 0x36be, 0xc449, 0x05e9, \
+  0xd42c, 0xfceb, 0xa353, 0xa279, 0x3fa4, 0x25d4, 0x9e46, 0x8e05, 0x2b0a, 0x5232, 0xee68, 0x815d, 0x93c0, 0x7dff, \
+  /* Point P13 = [1 + 0*(2^56) + 1*(2^112) + 1*(2^168)]*G */                                                      \
+  0x1206, 0x90f9, 0x54a3, 0xf56c, 0x9613, 0x9653, 0x7d75, 0xd4f5, 0xa0a7, 0xa5e0, 0x132a, 0x71b1, 0xbc11, 0x5a75, \
+  0xb55d, 0x95db, 0xb228, 0x6887, 0xc943, 0x794f, 0x8366, 0xfc03, 0x6924, 0x8c11, 0x2fa1, 0x3b0f, 0x7494, 0x1bd6, \
+  0x3896, 0x1b78, 0xf15c, 0x4a10, 0x83ce, 0x73cf, 0x11e7, 0xbe13, 0x1281, 0xa7b0, 0x5ee9, 0xb061, 0xdd2d, 0x1d32, \
+  /* Point P14 = [0 + 1*(2^56) + 1*(2^112) + 1*(2^168)]*G */                                                      \
+  0x988f, 0x4843, 0x31a9, 0x63bf, 0x93e2, 0x93b0, 0xea06, 0x700c, 0xac7e, 0x2153, 0x43bd, 0x959f, 0x1233, 0x0239, \
+  0x1601, 0xd3ed, 0x58ac, 0xdc95, 0x9099, 0x340a, 0x6d7c, 0x52e1, 0x280d, 0x385d, 0x27a9, 0xaeed, 0x89df, 0x01ed, \
+  0x9a66, 0x468c, 0xdda2, 0x665a, 0x48f9, 0xd811, 0xcb28, 0x2dfa, 0x8c9d, 0x690c, 0x1b2c, 0x95eb, 0xf3c6, 0x269e, \
+  /* Point P15 = [1 + 1*(2^56) + 1*(2^112) + 1*(2^168)]*G */                                                      \
+  0xcef8, 0x296b, 0x53b1, 0xa9e7, 0x4507, 0x3ba0, 0x8f7c, 0x4cb8, 0x1def, 0x0672, 0xe777, 0xc729, 0x3044, 0x32f4, \
+  0x0cdc, 0xf64d, 0xcafe, 0x6b41, 0xa62e, 0xb83c, 0x5f1b, 0xe19e, 0xf772, 0xcf8a, 0x50b0, 0x9846, 0x1c6e, 0x0482, \
+  0x1782, 0x1593, 0xbd74, 0xf336, 0xdeb2, 0x5649, 0x8bbd, 0x698b, 0x22e6, 0xfe9a, 0x5ebf, 0x763b, 0x34fb, 0x18ae };
+
+const ECDPARAM CURVE_P223 = {
+  14,
+  235,
+  crvp223_a24,
+  crvp223_dte,
+  crvp223_rma,
+  crvp223_rm1,
+  crvp223_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^255 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp255_a24[2] = { 0x0003, 0x0000 };
+
+static const Word crvp255_dte[256/WSIZE] = {                                                                                      \
+  0x5548, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5555 };
+
+static const Word crvp255_rma[256/WSIZE] = {                                                                                      \
+  0x94f5, 0x1863, 0x6276, 0xaa1b, 0x1542, 0x04e9, 0xb6a1, 0x686a, 0x54a4, 0x156f, 0xbf33, 0x661c, 0x96d7, 0xa995, 0xe8da, 0x6072 };
+
+static const Word crvp255_rm1[256/WSIZE] = {                                                                                      \
+  0xa0b0, 0x4a0e, 0x1b27, 0xc4ee, 0xe478, 0xad2f, 0x1806, 0x2f43, 0xd7a7, 0x3dfb, 0x0099, 0x2b4d, 0xdf0b, 0x4fc1, 0x2480, 0x2b83 };
+
+static const Word crvp255_tbl[16*3*(256/WSIZE)] = {                                                                               \
+  /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, \
+  /* Point P01 = [1 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xba78, 0x13d0, 0x1aed, 0x58ae, 0x231d, 0xd22f, 0x2db9, 0xc3bc, 0x4a96, 0xf249, 0xac59, 0x19f9, 0x3ada, 0x5e31, 0x77be, 0x6994, \
+  0x9b77, 0xb4e4, 0xe66a, 0xa006, 0xdc27, 0x968f, 0xa2ce, 0x58cc, 0x1f80, 0x121d, 0x56d2, 0x2e2d, 0xbfac, 0xdc6d, 0xa6df, 0x64e9, \
+  0x6b5e, 0x9be2, 0x2b39, 0x6a6e, 0x9ae8, 0x0216, 0xbb6a, 0x7d8d, 0x1633, 0xa684, 0x90ce, 0xb832, 0x498d, 0x882e, 0x9131, 0x2029, \
+  /* Point P02 = [0 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xd02e, 0x0bf5, 0xaafd, 0x95f3, 0x1d48, 0xeeb0, 0x776d, 0x3cdf, 0x8f68, 0x1325, 0x8768, 0x392e, 0xbe8c, 0xfa86, 0x17c6, 0x52bc, \
+  0xf725, 0x04eb, 0x2424, 0xe8d3, 0x4af1, 0x366d, 0xb2b6, 0x5b45, 0xe956, 0xe231, 0xa97e, 0xc7da, 0x92ba, 0xd592, 0xc3f4, 0x78e4, \
+  0x281a, 0xc0ca, 0x157e, 0xa8ae, 0xe21b, 0x330c, 0x8053, 0x44d0, 0x4fa4, 0x4df0, 0xf706, 0xb4dd, 0x5035, 0x0442, 0x9d55, 0x306f, \
+  /* Point P03 = [1 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xa6e6, 0xda89, 0x27a0, 0xc4b9, 0x2add, 0xb0ae, 0x14dc, 0xccc7, 0xbc4a, 0xd5b3, 0xe990, 0xefac, 0x9bf1, 0x1fae, 0xaccf, 0x1831, \
+  0xfc63, 0x89ac, 0xbdc6, 0x868e, 0x4eb8, 0x7ac8, 0xbb7e, 0xe86b, 0x7625, 0x11cc, 0xfad4, 0xee18, 0x4175, 0x8373, 0x10f3, 0x4859, \
+  0x8397, 0x4ca8, 0x5001, 0x52a9, 0x8e12, 0xc7f0, 0x9cdd, 0x696e, 0x051a, 0x543f, 0x1f16, 0xc06e, 0x7884, 0x8045, 0xd713, 0x010f, \
+  /* Point P04 = [0 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                                                      \
+  0x4345, 0x0b02, 0x7f80, 0xc0cb, 0x7d6a, 0x7059, 0xb274, 0x72c0, 0x4b24, 0x8e3d, 0x227f, 0x420c, 0x7c1e, 0x9b3c, 0xce1d, 0x6a74, \
+  0x834c, 0xbf33, 0xea11, 0xb4d7, 0xf613, 0xce76, 0x2722, 0x5eb6, 0x2c62, 0xefbe, 0x7ad1, 0xd3f0, 0x7a27, 0x90ab, 0x5249, 0x0999, \
+  0xdbcd, 0xbba6, 0x8143, 0xe243, 0x7c3d, 0x0018, 0xc3cf, 0x3f63, 0x4b89, 0x8921, 0xce28, 0x5d00, 0x593e, 0x1c45, 0x9900, 0x3726, \
+  /* Point P05 = [1 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xe9b0, 0xbd0e, 0xfbb5, 0x7cfe, 0x6074, 0x628d, 0x3e45, 0x4531, 0xd11d, 0xb77b, 0xa8fc, 0xf0fc, 0xb263, 0x684d, 0xb5d6, 0x51f9, \
+  0x19af, 0xcd94, 0x8b44, 0x9303, 0xd219, 0x5b2b, 0xe28a, 0x88e9, 0xa4bd, 0xb6c6, 0xb396, 0x61c8, 0x9993, 0x2716, 0xd997, 0x3aa7, \
+  0x4c38, 0x4dd2, 0x3b46, 0x3bbf, 0xe5b4, 0x049b, 0x4623, 0x221c, 0xa439, 0x85ed, 0xd6ea, 0xbc24, 0x50f0, 0x4292, 0xf2a1, 0x4d66, \
+  /* Point P06 = [0 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                                                      \
+  0x7113, 0x8d93, 0xfe73, 0x0109, 0x1de6, 0x0be0, 0x21f6, 0x4b21, 0x2d0f, 0xfd7b, 0x5a6a, 0x74c5, 0xffa9, 0xe412, 0x2773, 0x7990, \
+  0x2d8d, 0x0af0, 0x05d2, 0x4bcf, 0x5f85, 0x0d9e, 0xf9a0, 0xbebc, 0x01d4, 0xcdef, 0xab24, 0xd305, 0x0e43, 0x142b, 0x301d, 0x780c, \
+  0xb969, 0x1101, 0xa30c, 0x266c, 0x0963, 0xdfc1, 0xa02b, 0xbdda, 0x291e, 0xb3ad, 0x97d1, 0x0f2b, 0x9a96, 0xb218, 0xe341, 0x37ab, \
+  /* Point P07 = [1 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                                                      \
+  0xdaba, 0xf25b, 0x0f0d, 0x7523, 0x4114, 0x327e, 0xb92d, 0x66f4, 0xa3aa, 0xcdc9, 0x46a6, 0x6b20, 0x79fc, 0x7676, 0xf569, 0x4256, \
+  0xe2e7, 0xa5a8, 0x3a71, 0x9ed1, 0x1fd4, 0x2948, 0x3d63, 0x97ff, 0xccad, 0x8839, 0x4e75, 0x3251, 0x1a88, 0x5755, 0xdebc, 0x7fd9, \
+  0x18d3, 0x8ed6, 0xe274, 0x9e0b, 0x456c, 0x3531, 0xdaef, 0x60c7, 0xd80b, 0x5504, 0x6836, 0x4bb3, 0x4f52, 0xc404, 0x6814, 0x6b09, \
+  /* Point P08 = [0 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                                                      \
+  0xabe3, 0x4701, 0x5b65, 0x9596, 0xe37c, 0x2923, 0xdcb1, 0x68a9, 0x4222, 0x0366, 0x7a21, 0x3331, 0x48b2, 0x6b43, 0xca02, 0x1278, \
+  0xde52, 0x32a7, 0xfa68, 0x8db3, 0xa92b, 0x09d2, 0x424f, 0x4182, 0xe1e2, 0x8923, 0x720a, 0x8c2d, 0x35b3, 0x0e6a, 0x37d9, 0x7dfa, \
+  0x2b6a, 0x422d, 0x5df9, 0xee04, 0x9c55, 0xadda, 0x9a5d, 0x049b, 0x7301, 0xee0b, 0xf892, 0x3ca5, 0x414d, 0x4bfa, 0xc831, 0x722b, \
+  /* Point P09 = [1 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                                                      \
+  0x4237, 0x7b8e, 0x1118, 0xbc0b, 0x3fe2, 0xe2dc, 0x053b, 0xf42a, 0xb0eb, 0x1490, 0x5d7b, 0xf9bb, 0x9145, 0xe6cc, 0x47c9, 0x73ab, \
+  0x1e70, 0xad9a, 0xee8d, 0xfa66, 0xc4ee, 0x4efe, 0x8244, 0xde52, 0x935a, 0x8810, 0xfe76, 0x4f3f, 0xa0eb, 0x2d64, 0xf8f2, 0x0d99, \
+  0x217d, 0x3642, 0x7dc3, 0x69d9, 0xd2c7, 0xba09, 0xf0b2, 0xb762, 0x1457, 0xdb8c, 0x0aa8, 0x8428, 0x5385, 0x65e9, 0x6153, 0x71a3, \
+  /* Point P10 = [0 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                                                      \
+  0x7e83, 0x9bae, 0xc132, 0x5424, 0xed56, 0x84c4, 0xdb51, 0x4f08, 0x3ab8, 0x3672, 0x109d, 0x3593, 0x165e, 0xdca6, 0x5c93, 0x6b8b, \
+  0xd8ad, 0xec4c, 0x10c7, 0x8e7d, 0xa6d2, 0x5c36, 0x0d62, 0x46cb, 0xcf0c, 0xf6c2, 0x5448, 0xe8e6, 0x81a5, 0x2ee2, 0x85a7, 0x074f, \
+  0x80dd, 0xfcf3, 0xb671, 0xbba2, 0x24ac, 0xa001, 0x7461, 0xd341, 0x6608, 0x7eba, 0xc477, 0xbdd6, 0x462c, 0x4ee4, 0x63ea, 0x1e47, \
+  /* Point P11 = [1 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                                                      \
+  0x6cc7, 0x2efe, 0xb1ba, 0xb9f2, 0x7946, 0x4c95, 0xdd29, 0x4b14, 0x5f58, 0x0627, 0x79fd, 0xc084, 0xf87a, 0x7091, 0x0a7e, 0x3685, \
+  0xcb07, 0x2f9c, 0x06a0, 0x2c1d, 0xb5ed, 0x41e4, 0x0842, 0xd7cf, 0x75b7, 0x4109, 0xe6f9, 0xee0a, 0x597f, 0x969c, 0x2496, 0x2b1b, \
+  0x78c3, 0xdfed, 0x3df2, 0x64b0, 0xf569, 0xfbed, 0x17f0, 0xd50d, 0x313c, 0x61aa, 0xa490, 0x6c81, 0x29da, 0x9e91, 0x2abb, 0x3a2c, \
+  /* Point P12 = [0 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                                                      \
+  0xc133, 0x80d9, 0xd375, 0x2857, 0xa2d0, 0xae01, 0xb135, 0x12ae, 0x38f3, 0x8695, 0xc1f2, 0x6fde, 0x6ed8, 0xa409, 0x386d, 0x1e63, \
+  0x867c, 0x7008, 0x8e57, 0x27c6, 0x7f0f, 0x5cbe, 0xcd30, 0x78e3, 0x585f, 0x6910, 0x8d0b, 0x4d5f, 0x576e, 0x57dd, 0xd5bf, 0x5ef6, \
+  0x206d, 0x632d, 0x45d8, 0x7dec, 0x79e9, 0x1bf8, 0x1c10, 0xd76e, 0xc8d5, 0x0f61, 0xea8c, 0xb88f, 0x07e4, 0x8328, 0x303f, 0x2387, \
+  /* Point P13 = [1 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                                                      \
+  0xa325, 0x152f, 0x7afc, 0x5f17, 0x84fe, 0xb574, 0x7dcf, 0x6195, 0xb792, 0x1554, 0x6fb4, 0x4ad1, 0x8f6c, 0xfa1f, 0x1b18, 0x57b8, \
+  0x4654, 0xe9f4, 0xa0a6, 0xccd9, 0xbed9, 0xb74c, 0x0e44, 0x9017, 0xbc0c, 0xb486, 0xb46c, 0xff18, 0x17a8, 0x4349, 0x2550, 0x0591, \
+  0xcbb5, 0xaba4, 0xbf60, 0x6138, 0x3132, 0x319b, 0xe690, 0x40c6, 0xdb37, 0x1c59, 0x2c17, 0x5ad9, 0xbcb2, 0x1f99, 0xebff, 0x5b99, \
+  /* Point P14 = [0 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                                                      \
+  0x079b, 0xd5af, 0x58fe, 0xe05e, 0x4c08, 0x1ae1, 0x97a4, 0x7f96, 0xda20, 0x6079, 0x2abc, 0x31a7, 0xf05f, 0x6c01, 0x71bb, 0x7914, \
+  0x2b27, 0x4cd0, 0xafea, 0x0cf0, 0x45ea, 0xb907, 0x7121, 0xe11e, 0x76da, 0x650a, 0x8522, 0x99ca, 0xa75c, 0x22b5, 0x9b23, 0x1d58, \
+  0x08b7, 0xa8b0, 0xfa12, 0x6869, 0x5aa0, 0x1746, 0x47df, 0xf1b9, 0x7cd0, 0xdfd9, 0x9ff1, 0x3c32, 0x9885, 0xdfcc, 0x073f, 0x06be, \
+  /* Point P15 = [1 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                                                      \
+  0xa895, 0x86e7, 0xcac0, 0x9b26, 0xd651, 0xc8cd, 0x358c, 0x2263, 0xb22f, 0xa74c, 0x890c, 0x3c2e, 0x1357, 0x7dbd, 0xa9f5, 0x65dc, \
+  0xe3ac, 0xbaa1, 0x1aa9, 0xe730, 0x395c, 0x8991, 0x3b6c, 0xac12, 0xd925, 0x5f63, 0x3559, 0xef2e, 0x21f7, 0xae6d, 0xb928, 0x2680, \
+  0x9084, 0x2a33, 0xadb1, 0x25d1, 0x3085, 0x1536, 0x3555, 0xc948, 0x70c0, 0xadc0, 0x244e, 0x7c1c, 0x112f, 0x3270, 0x36e5, 0x370d };
+
+const ECDPARAM CURVE_P255 = {
+  16,
+  19,
+  crvp255_a24,
+  crvp255_dte,
+  crvp255_rma,
+  crvp255_rm1,
+  crvp255_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+#elif (WSIZE == 32) // CURVE PARAMETERS REPRESENTED WITH 32-BIT WORDS /////////
+///////////////////////////////////////////////////////////////////////////////
+
+// p = 2^159 - 91, (A+2)/4 = 797892, B = 2 (generated by gen_param)
+
+static const Word crvp159_a24[1] = { 0x000c2cc4 };
+
+static const Word crvp159_dte[160/WSIZE] = {                  \
+  0x4be24044, 0x4aebd788, 0xf4ad91d6, 0xc5486055, 0x0eaa4037 };
+
+static const Word crvp159_rma[160/WSIZE] = {                  \
+  0x6bce85f4, 0x3d7cccec, 0x7c342c87, 0x628406f2, 0x217281de };
+
+static const Word crvp159_rm1[160/WSIZE] = {                  \
+  0xb8073d57, 0xfb9cdee9, 0x155887e8, 0xacfacd11, 0x1f2dbd09 };
+
+static const Word crvp159_tbl[16*3*(160/WSIZE)] = {           \
+  /* Point P00 = [0 + 0*(2^40) + 0*(2^80) + 0*(2^120)]*G */   \
+  0xffffffd3, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0xffffffd3, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, \
+  /* Point P01 = [1 + 0*(2^40) + 0*(2^80) + 0*(2^120)]*G */   \
+  0x65ef72e6, 0xf3ec35a9, 0x0fdcbe36, 0xeccc33de, 0x3d7ae17e, \
+  0xac864470, 0xcb3a6432, 0x4baba4b0, 0xedbf7cc8, 0x68ec3830, \
+  0xe21b29e5, 0xc617fb45, 0x06c268ef, 0x2774d774, 0x081b929f, \
+  /* Point P02 = [0 + 1*(2^40) + 0*(2^80) + 0*(2^120)]*G */   \
+  0x49185532, 0xde2758fb, 0x79596ead, 0x3137d254, 0x5b266706, \
+  0x644866f7, 0xdac11153, 0x3d72953a, 0xaff51c67, 0x787e2eb6, \
+  0xbba68d6c, 0x914050a1, 0x9d223b07, 0x0f925c3a, 0x7cadd7eb, \
+  /* Point P03 = [1 + 1*(2^40) + 0*(2^80) + 0*(2^120)]*G */   \
+  0x93014abc, 0xb9facfce, 0x7895fe88, 0x9d4f830a, 0x05b51c3a, \
+  0xc31c78af, 0x3501847c, 0x1748bc0e, 0xde78ce26, 0x5ea5ba2b, \
+  0x4bc88a88, 0x6152bf79, 0x427906d5, 0x36276121, 0x54ad08a0, \
+  /* Point P04 = [0 + 0*(2^40) + 1*(2^80) + 0*(2^120)]*G */   \
+  0x3e5dfd5d, 0x840e57f3, 0x3ad31187, 0xc84b9a41, 0x4e4ab963, \
+  0xd1f108c4, 0xf680c25b, 0x6c51bd9f, 0xe88bfa4d, 0x53fc43ed, \
+  0x651ee365, 0xd0f74b73, 0x23298a95, 0x9310c99b, 0x2955873c, \
+  /* Point P05 = [1 + 0*(2^40) + 1*(2^80) + 0*(2^120)]*G */   \
+  0x71f61713, 0x4c6f0fa8, 0xabeca8c1, 0xb9859264, 0x455e286b, \
+  0xaf859122, 0xce55701c, 0x2cc2de66, 0xe3b0494c, 0x6f04f331, \
+  0x068ecdd2, 0x04317ee9, 0xfa485fd9, 0x52b7072a, 0x246285e0, \
+  /* Point P06 = [0 + 1*(2^40) + 1*(2^80) + 0*(2^120)]*G */   \
+  0xdbd7f2b9, 0x1e27f845, 0x6ee3d14a, 0x73103974, 0x1fb609f0, \
+  0x30ef9069, 0xeadba25e, 0x630ba571, 0x5bc56ffe, 0x64de3bb3, \
+  0x6976be95, 0x615cdd84, 0xad07e9fe, 0x85719d2d, 0x4a596dba, \
+  /* Point P07 = [1 + 1*(2^40) + 1*(2^80) + 0*(2^120)]*G */   \
+  0xa37338db, 0x3fa882d3, 0x9dba6b0f, 0xdae92657, 0x5103b481, \
+  0x4249b495, 0xa329bc67, 0x02230b94, 0x1f086f0b, 0x3f68fe5f, \
+  0xed1b100e, 0x35cdfda8, 0x11be4948, 0xf2a69088, 0x21a0ac2b, \
+  /* Point P08 = [0 + 0*(2^40) + 0*(2^80) + 1*(2^120)]*G */   \
+  0xcf0e03f9, 0x211940aa, 0x93474bd8, 0x5574f07b, 0x29f12058, \
+  0x0b387be2, 0x1daed144, 0x803862e7, 0xd0b339c5, 0x4fbb0360, \
+  0x350f4c20, 0x1ab8489c, 0x6c36756a, 0xb6caf25e, 0x34c63786, \
+  /* Point P09 = [1 + 0*(2^40) + 0*(2^80) + 1*(2^120)]*G */   \
+  0x30d9bf75, 0x84e00c3d, 0x8df709b7, 0x539bf206, 0x17860d29, \
+  0xe1da6686, 0x58820515, 0x63382672, 0x85a456ca, 0x3f7d269d, \
+  0x14e17472, 0x65ea6a39, 0x9b329810, 0x1c5c3e70, 0x09cc2623, \
+  /* Point P10 = [0 + 1*(2^40) + 0*(2^80) + 1*(2^120)]*G */   \
+  0xe26001e9, 0x45be4d88, 0x678e9c32, 0x3ec896bd, 0x10b614d4, \
+  0x1f268d04, 0x3f7bf5c4, 0xdffeb15d, 0xaa6fa488, 0x6620b701, \
+  0xe873315d, 0xf6fb3c32, 0xd6ef2a6e, 0x19726ace, 0x4e1fbd04, \
+  /* Point P11 = [1 + 1*(2^40) + 0*(2^80) + 1*(2^120)]*G */   \
+  0x494f2718, 0x6f307c1b, 0x3af88bbb, 0x2bb1172f, 0x741077f4, \
+  0x82b11d5f, 0xe78a4883, 0xee4e6e20, 0xdb80a24a, 0x4a2a15e1, \
+  0x6753d8b9, 0xa383d3eb, 0x5b0dd2a7, 0x42b0e495, 0x247bca1f, \
+  /* Point P12 = [0 + 0*(2^40) + 1*(2^80) + 1*(2^120)]*G */   \
+  0x5fd80dd4, 0xcc8d2d90, 0xa74af283, 0x1c7e97c5, 0x18b7073c, \
+  0x8903ff94, 0xc9b1138e, 0x6ea7f07f, 0x82c27405, 0x77a2aab5, \
+  0x5326c5a5, 0x779d9bbf, 0x6f505d70, 0x361bd836, 0x54b0813f, \
+  /* Point P13 = [1 + 0*(2^40) + 1*(2^80) + 1*(2^120)]*G */   \
+  0x36f58a87, 0x06b3a296, 0x0852247f, 0xf0a2b07e, 0x0f568639, \
+  0x3dc2437e, 0x05898097, 0x98ff68c1, 0x9493d7b5, 0x1e35bea4, \
+  0xc0a12bb7, 0x17e6a024, 0xdc92bc88, 0xfb184c10, 0x6e8e1f13, \
+  /* Point P14 = [0 + 1*(2^40) + 1*(2^80) + 1*(2^120)]*G */   \
+  0x2511f32c, 0xf47aa6dc, 0x0621a46c, 0x02862219, 0x6ae0aa48, \
+  0xc06bde43, 0x454173c4, 0xa3fc62ad, 0xd21c88dc, 0x3756806a, \
+  0x3aa4d262, 0x30c10b8f, 0xbfc0734f, 0xe3d3bb80, 0x28f42ed7, \
+  /* Point P15 = [1 + 1*(2^40) + 1*(2^80) + 1*(2^120)]*G */   \
+  0xd2e755e8, 0xafc76407, 0xfc391b6d, 0x5c9f117d, 0x2aac6128, \
+  0x2ba86cf6, 0x6df0322b, 0xdf995033, 0xf5ce9727, 0x3d20a90b, \
+  0xb1547552, 0xc2aef2c7, 0xfd66a78f, 0xfa845971, 0x2f724636 };
+
+const ECDPARAM CURVE_P159 = {
+  5,
+  91,
+  crvp159_a24,
+  crvp159_dte,
+  crvp159_rma,
+  crvp159_rm1,
+  crvp159_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^191 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp191_a24[1] = { 0x00000003 };
+
+static const Word crvp191_dte[192/WSIZE] = {                              \
+  0x55555548, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555 };
+
+static const Word crvp191_rma[192/WSIZE] = {                              \
+  0x9ca4e354, 0x2c6d1451, 0x64ffa597, 0x87d66df7, 0x49889e49, 0x6cd2d922 };
+
+static const Word crvp191_rm1[192/WSIZE] = {                              \
+  0x2231b635, 0xbd7e9efa, 0x6cf80b5c, 0xea189a3a, 0x2847d61c, 0x67097b81 };
+
+static const Word crvp191_tbl[16*3*(192/WSIZE)] = {                       \
+  /* Point P00 = [0 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */               \
+  0xfffffff7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0xfffffff7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, \
+  /* Point P01 = [1 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */               \
+  0xcfa8a7d2, 0x179e34d3, 0xa791c71c, 0x27fce038, 0x9ba53696, 0x4057e6e0, \
+  0xcc6b0609, 0x3876f089, 0xebfdee2b, 0xa7d16037, 0xbf2afec1, 0x210a0d8c, \
+  0x276bb81c, 0xddc17432, 0x8dc2f930, 0x43dd49e0, 0x9f249bd2, 0x7ad7f920, \
+  /* Point P02 = [0 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */               \
+  0xe16dbcfc, 0x482100e2, 0x305f2114, 0x766a68d6, 0x4ad94278, 0x1f1ae063, \
+  0x74d6da18, 0x6b69ef96, 0xee86c627, 0x1ade8c0e, 0x58114317, 0x0e056ff1, \
+  0x8bdf16b4, 0xe00cf1db, 0x1ea81047, 0xc02c511f, 0x5af27ad6, 0x6e36f77f, \
+  /* Point P03 = [1 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */               \
+  0xa0bf093f, 0x5140ded8, 0xec1c360a, 0xa7d1576d, 0x6cd31f42, 0x5cdb5be4, \
+  0xc8079b79, 0x9a87d009, 0xadc5431f, 0xd2cfaffb, 0x35badda4, 0x36cc6c7f, \
+  0x2eb62e59, 0xb76fb8e5, 0x6c0abc19, 0x40e214a7, 0xe10c8153, 0x6472fa3a, \
+  /* Point P04 = [0 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */               \
+  0x928c5944, 0x3c771adb, 0x7d05bf82, 0xed7f170a, 0xcc93fa43, 0x79bb7bd9, \
+  0x46b0a789, 0x1cd95102, 0x79965fae, 0x3667f5fc, 0x9be7401c, 0x3df31454, \
+  0x783b1813, 0xd8dbed04, 0xdd6562ce, 0x2b54e274, 0x3963a935, 0x2afd2fce, \
+  /* Point P05 = [1 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */               \
+  0xc3078653, 0x0b0820e7, 0x9112a7a3, 0x86ffd6de, 0x40a15670, 0x12364938, \
+  0x6f83cd34, 0x0f5bd438, 0x2ba4d9e4, 0xc15f935a, 0x31be3941, 0x3dd5a8a2, \
+  0x755f4bf4, 0x98548236, 0x4b8ada21, 0xe77659e2, 0xb9a7023a, 0x7c2894d4, \
+  /* Point P06 = [0 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */               \
+  0xfcd19f55, 0x29361927, 0x8c897ed4, 0x27bc817c, 0x86867d79, 0x28c556f4, \
+  0x03753919, 0xea2584f4, 0x74580132, 0xe8ea16a7, 0xb03cf0b4, 0x2a1f5f35, \
+  0x590e6b97, 0xf23cb16c, 0xf4dc2c82, 0x6000f2e4, 0xcabb21e5, 0x3c138ce4, \
+  /* Point P07 = [1 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */               \
+  0xc795fbec, 0xdec6e2dc, 0x183c0cd5, 0xccd86939, 0xf266a86c, 0x3ace5fe5, \
+  0x235a7ffc, 0xc989e2bd, 0x9d675e28, 0x68258a2d, 0x088be3c2, 0x1db1df6d, \
+  0x8c54eeeb, 0xac8345af, 0x1ee60406, 0x611ed0f4, 0x64791691, 0x68f9f3ee, \
+  /* Point P08 = [0 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */               \
+  0xdcb8d624, 0x2f82df38, 0xebeffbfc, 0xc4004d70, 0x58555564, 0x43356d74, \
+  0xaecb5fcb, 0xa2be0293, 0xfccc6f57, 0xe4956e13, 0xdff8f3bb, 0x1031d335, \
+  0x6ee3e768, 0x77e3b8fa, 0x9be5ffbb, 0xbc7680fc, 0x384c8fcd, 0x2af8483c, \
+  /* Point P09 = [1 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */               \
+  0x54845633, 0xbe46b9d9, 0x4c8574db, 0xa00b87a0, 0x88c90d80, 0x4b0141f5, \
+  0x3905a1f7, 0x1a513e79, 0x6aef325f, 0x482a8ddc, 0x92b89152, 0x763ee755, \
+  0xe22cabc2, 0x079d882e, 0x1749a637, 0x40936dd3, 0xd2526a71, 0x03c38ce7, \
+  /* Point P10 = [0 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */               \
+  0x2937d695, 0xbe748838, 0xa853c418, 0x6b74e768, 0x94e8f001, 0x1b0dd394, \
+  0xa7b36486, 0xc021cf89, 0x18f27df7, 0xfe12afd6, 0x22bff8fd, 0x61758a8a, \
+  0x8d71d2a5, 0xbca2b2c8, 0x5120cc45, 0x66f5a255, 0xfc987af0, 0x62154a27, \
+  /* Point P11 = [1 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */               \
+  0xab1bcd43, 0x30dfbaf5, 0xf122d7ea, 0x7d33dddc, 0x2d8a2b20, 0x66d9cb50, \
+  0x0e18e47b, 0x8625bb92, 0x0abe7470, 0xb1f58eeb, 0x93777bc0, 0x07bdbedb, \
+  0x3a96982a, 0x6563e97e, 0x5abd48cf, 0xc9f762ff, 0xcf650022, 0x769d973f, \
+  /* Point P12 = [0 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */               \
+  0xc8a50fcf, 0xa3f8fa11, 0x96b992ba, 0x4098478b, 0x700db7b2, 0x69fa0ed5, \
+  0xa29c9242, 0xd582fcb0, 0x57ef6539, 0xa016fdb3, 0x022a7fd9, 0x7ca6f8f7, \
+  0xd8b12733, 0xb612d8fc, 0x865bf160, 0x0a13e42b, 0x2f072045, 0x54578122, \
+  /* Point P13 = [1 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */               \
+  0xf756aa17, 0x6c897151, 0x5c784ed6, 0xb99319e9, 0x8987f88a, 0x12391708, \
+  0xc69fa80d, 0xc3197459, 0x90241712, 0xb87e2891, 0xcea4affa, 0x495363e9, \
+  0xfbcbc775, 0x3bde1d92, 0x45c2df8a, 0x1b4dc2c0, 0x4b3a4ceb, 0x124975fd, \
+  /* Point P14 = [0 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */               \
+  0x1c6de07c, 0x375bf72e, 0x832e1a7b, 0x47929752, 0x9ec70be7, 0x6f79ccd2, \
+  0x67ae523a, 0x1e5cd42a, 0xd6a52fc2, 0xe8c55f5e, 0x0bd9696a, 0x74082efe, \
+  0x0959edce, 0xbfa769f9, 0x4beece5d, 0x6b93a8eb, 0xbfd832de, 0x39ccb1ce, \
+  /* Point P15 = [1 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */               \
+  0x0d2b5c78, 0xbc2c161a, 0x245a5578, 0xc3029124, 0x6026ac84, 0x58733f80, \
+  0x258041ba, 0x4f57e22a, 0xcc289413, 0xcca83752, 0xc0442f90, 0x0055e90b, \
+  0xa600f783, 0xeca612a9, 0x43416014, 0x4672aca7, 0xf7fc444a, 0x683158f1 };
+
+const ECDPARAM CURVE_P191 = {
+  6,
+  19,
+  crvp191_a24,
+  crvp191_dte,
+  crvp191_rma,
+  crvp191_rm1,
+  crvp191_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^223 - 235, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp223_a24[1] = { 0x00000003 };
+
+static const Word crvp223_dte[224/WSIZE] = {                                          \
+  0x555554b8, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555 };
+
+static const Word crvp223_rma[224/WSIZE] = {                                          \
+  0x55c09e96, 0xfd70f38a, 0x5591103c, 0xeed02158, 0xbe600e38, 0x5a3a284b, 0x1a9921d3 };
+
+static const Word crvp223_rm1[224/WSIZE] = {                                          \
+  0xe913acd2, 0xa479b356, 0xf73ff658, 0xb896d1f2, 0xdfb4facf, 0x2c96abae, 0x2917db56 };
+
+static const Word crvp223_tbl[16*3*(224/WSIZE)] = {                                   \
+  /* Point P00 = [0 + 0*(2^56) + 0*(2^112) + 0*(2^168)]*G */                          \
+  0xffffff8b, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0xffffff8b, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, \
+  /* Point P01 = [1 + 0*(2^56) + 0*(2^112) + 0*(2^168)]*G */                          \
+  0x5eb1fb2f, 0x5ce80c01, 0xe062b763, 0x82c6a1b6, 0xbda129fa, 0xf36aa3c9, 0x14d9829b, \
+  0xe3f9e93a, 0x4279679d, 0xfe2a316a, 0x3787e250, 0x09cbe102, 0x46f6729e, 0x3af086b1, \
+  0x484a104c, 0x325c788f, 0x1c3a2e76, 0xa1848121, 0xdbf83f62, 0x2adbbad1, 0x643c9fc8, \
+  /* Point P02 = [0 + 1*(2^56) + 0*(2^112) + 0*(2^168)]*G */                          \
+  0xe4abe981, 0xe133139a, 0xcb9a381d, 0xcd234dcf, 0x780a19db, 0xd1f8941d, 0x47d0ffe8, \
+  0xfc1b0a97, 0x5ef959f8, 0xa57a453f, 0xf0a142c8, 0xcdb2b135, 0x27920fe7, 0x62428aab, \
+  0x7935843e, 0x923c5766, 0xd68582c1, 0x23f4983d, 0x7101334f, 0xa57219f3, 0x64fa60f9, \
+  /* Point P03 = [1 + 1*(2^56) + 0*(2^112) + 0*(2^168)]*G */                          \
+  0x60336c0c, 0xd533d124, 0x6b14487b, 0xf21e5f34, 0x2523175d, 0x5d67b585, 0x4959979b, \
+  0x7a5cea67, 0x5ec7a9ed, 0xccdbbe88, 0x2534d2d1, 0x0afe1465, 0xc614bd1b, 0x530fc9e4, \
+  0x6a02c346, 0x6524275c, 0x70f2a83d, 0x5065e405, 0x7352a2e2, 0xc2ef6508, 0x19f467fe, \
+  /* Point P04 = [0 + 0*(2^56) + 1*(2^112) + 0*(2^168)]*G */                          \
+  0x65f3da44, 0x36c21ba6, 0x1d20aac6, 0x9e8b1c1e, 0x710fcbe3, 0x783fc208, 0x5449258d, \
+  0xfb993140, 0x1f04249c, 0x34711a27, 0x2e27285b, 0x5ea26d38, 0xa6b083ab, 0x361c1998, \
+  0xb23f3d24, 0xe942f1e4, 0x930d08b2, 0x348de6ef, 0x2fd22f5a, 0xe3a0137a, 0x003ca0c8, \
+  /* Point P05 = [1 + 0*(2^56) + 1*(2^112) + 0*(2^168)]*G */                          \
+  0x885a44a6, 0x7b0076da, 0xda0f5c5b, 0x3755e3b2, 0xb1bf1c93, 0xd88fed46, 0x0888a2d2, \
+  0x15da53e0, 0x3ac5f16a, 0x0f3da6de, 0x27e0f775, 0x4fb71b6e, 0xe569d50b, 0x22d9616e, \
+  0x0a722972, 0x9fa94791, 0x9bfd3c99, 0x1905ff03, 0x1e3eafea, 0xa15ad2a5, 0x4f88d523, \
+  /* Point P06 = [0 + 1*(2^56) + 1*(2^112) + 0*(2^168)]*G */                          \
+  0xd4b4299c, 0xfc121b47, 0x96f1407b, 0x4d5676e0, 0x433447ea, 0x8d4cfca6, 0x75cfc137, \
+  0xd37c119e, 0xe069cb11, 0x8015a1c7, 0x00fb5518, 0x59efe23f, 0xdbead9b1, 0x04fbcbb1, \
+  0x6506b16e, 0x12ee71d5, 0x16b137b7, 0x976a65b8, 0xe36ba557, 0x426d990c, 0x6f734194, \
+  /* Point P07 = [1 + 1*(2^56) + 1*(2^112) + 0*(2^168)]*G */                          \
+  0xfe35de69, 0x61d95793, 0x954331dd, 0xb40426b3, 0x526076ab, 0x537eb2e8, 0x717c594e, \
+  0xc1fbec0d, 0x555d28f9, 0xca02d39a, 0xbdd8e89e, 0xe9822e1c, 0xf15dd576, 0x79dd7ca0, \
+  0x891a911a, 0xfe3d217a, 0x0de74e86, 0x60c73ccc, 0xfbe69845, 0xde79b1d9, 0x01bf389d, \
+  /* Point P08 = [0 + 0*(2^56) + 0*(2^112) + 1*(2^168)]*G */                          \
+  0x4e4b2c27, 0x9b3042dd, 0xabfee2af, 0xdfdf4c8c, 0x03d642a6, 0xa9406916, 0x2719aabd, \
+  0xc8315882, 0xbebef625, 0x9403b3b4, 0x0f335b69, 0x6eb11314, 0x1a0de910, 0x1d58e3c5, \
+  0x73bfecc6, 0x325331df, 0x49fb04b2, 0xbd456cb4, 0x3bd2d32e, 0xc8c33e92, 0x7d0a7d2d, \
+  /* Point P09 = [1 + 0*(2^56) + 0*(2^112) + 1*(2^168)]*G */                          \
+  0xcc3cd662, 0x8bbe86fb, 0xa0d39852, 0xd3e5a455, 0x5a11da76, 0x308a4a34, 0x10c11105, \
+  0x9a5dc4ba, 0x981978a9, 0x9cfd746c, 0x8541af0c, 0xd6786295, 0x94254240, 0x41a86704, \
+  0xb5ac038c, 0xd74dce22, 0x8eae096b, 0x7aaebdf7, 0xcb559b53, 0x41029def, 0x0b524ca2, \
+  /* Point P10 = [0 + 1*(2^56) + 0*(2^112) + 1*(2^168)]*G */                          \
+  0x6e1d53a6, 0x394f2f36, 0xf87457f5, 0xccbdd3ce, 0xe7ad0520, 0xaae5a10e, 0x35dcbf18, \
+  0x687f4410, 0x97615744, 0x352ec5fc, 0xa9a3254b, 0x50ed073e, 0x9270afc7, 0x361b6776, \
+  0x4d018406, 0xb2a4db3f, 0x0e070da9, 0xd1c8a39f, 0x6453f586, 0x14cf9b52, 0x0395eab2, \
+  /* Point P11 = [1 + 1*(2^56) + 0*(2^112) + 1*(2^168)]*G */                          \
+  0x351d5b02, 0xb6e3109d, 0x5bc87547, 0xa94fefd9, 0x3df65dd4, 0x699be7c8, 0x78445451, \
+  0xcd278a8d, 0x6d36785b, 0x8b31d089, 0x36ab1251, 0xcf6401c8, 0x810c2b0b, 0x63788f0c, \
+  0x318088d5, 0xf07fd8f9, 0xefb10af5, 0x66694a63, 0x175ec8b2, 0x481b303d, 0x43c13e18, \
+  /* Point P12 = [0 + 0*(2^56) + 1*(2^112) + 1*(2^168)]*G */                          \
+  0x565f0419, 0xfe426ef7, 0x388b66f9, 0x01383d15, 0xf19d4f96, 0xb09f35dc, 0x6d119715, \
+  0xc93abb05, 0xa1f6c141, 0x38283da5, 0x64a90d94, 0xa4cb2165, 0x36be4dc7, 0x05e9c449, \
+  0xfcebd42c, 0xa279a353, 0x25d43fa4, 0x8e059e46, 0x52322b0a, 0x815dee68, 0x7dff93c0, \
+  /* Point P13 = [1 + 0*(2^56) + 1*(2^112) + 1*(2^168)]*G */                          \
+  0x90f91206, 0xf56c54a3, 0x96539613, 0xd4f57d75, 0xa5e0a0a7, 0x71b1132a, 0x5a75bc11, \
+  0x95dbb55d, 0x6887b228, 0x794fc943, 0xfc038366, 0x8c116924, 0x3b0f2fa1, 0x1bd67494, \
+  0x1b783896, 0x4a10f15c, 0x73cf83ce, 0xbe1311e7, 0xa7b01281, 0xb0615ee9, 0x1d32dd2d, \
+  /* Point P14 = [0 + 1*(2^56) + 1*(2^112) + 1*(2^168)]*G */                          \
+  0x4843988f, 0x63bf31a9, 0x93b093e2, 0x700cea06, 0x2153ac7e, 0x959f43bd, 0x02391233, \
+  0xd3ed1601, 0xdc9558ac, 0x340a9099, 0x52e16d7c, 0x385d280d, 0xaeed27a9, 0x01ed89df, \
+  0x468c9a66, 0x665adda2, 0xd81148f9, 0x2dfacb28, 0x690c8c9d, 0x95eb1b2c, 0x269ef3c6, \
+  /* Point P15 = [1 + 1*(2^56) + 1*(2^112) + 1*(2^168)]*G */                          \
+  0x296bcef8, 0xa9e753b1, 0x3ba04507, 0x4cb88f7c, 0x06721def, 0xc729e777, 0x32f43044, \
+  0xf64d0cdc, 0x6b41cafe, 0xb83ca62e, 0xe19e5f1b, 0xcf8af772, 0x984650b0, 0x04821c6e, \
+  0x15931782, 0xf336bd74, 0x5649deb2, 0x698b8bbd, 0xfe9a22e6, 0x763b5ebf, 0x18ae34fb };
+
+const ECDPARAM CURVE_P223 = {
+  7,
+  235,
+  crvp223_a24,
+  crvp223_dte,
+  crvp223_rma,
+  crvp223_rm1,
+  crvp223_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^255 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp255_a24[1] = { 0x00000003 };
+
+static const Word crvp255_dte[256/WSIZE] = {                                                      \
+  0x55555548, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555 };
+
+static const Word crvp255_rma[256/WSIZE] = {                                                      \
+  0x186394f5, 0xaa1b6276, 0x04e91542, 0x686ab6a1, 0x156f54a4, 0x661cbf33, 0xa99596d7, 0x6072e8da };
+
+static const Word crvp255_rm1[256/WSIZE] = {                                                      \
+  0x4a0ea0b0, 0xc4ee1b27, 0xad2fe478, 0x2f431806, 0x3dfbd7a7, 0x2b4d0099, 0x4fc1df0b, 0x2b832480 };
+
+static const Word crvp255_tbl[16*3*(256/WSIZE)] = {                                               \
+  /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                      \
+  0xfffffff7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0xfffffff7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, \
+  /* Point P01 = [1 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                      \
+  0x13d0ba78, 0x58ae1aed, 0xd22f231d, 0xc3bc2db9, 0xf2494a96, 0x19f9ac59, 0x5e313ada, 0x699477be, \
+  0xb4e49b77, 0xa006e66a, 0x968fdc27, 0x58cca2ce, 0x121d1f80, 0x2e2d56d2, 0xdc6dbfac, 0x64e9a6df, \
+  0x9be26b5e, 0x6a6e2b39, 0x02169ae8, 0x7d8dbb6a, 0xa6841633, 0xb83290ce, 0x882e498d, 0x20299131, \
+  /* Point P02 = [0 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                      \
+  0x0bf5d02e, 0x95f3aafd, 0xeeb01d48, 0x3cdf776d, 0x13258f68, 0x392e8768, 0xfa86be8c, 0x52bc17c6, \
+  0x04ebf725, 0xe8d32424, 0x366d4af1, 0x5b45b2b6, 0xe231e956, 0xc7daa97e, 0xd59292ba, 0x78e4c3f4, \
+  0xc0ca281a, 0xa8ae157e, 0x330ce21b, 0x44d08053, 0x4df04fa4, 0xb4ddf706, 0x04425035, 0x306f9d55, \
+  /* Point P03 = [1 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                      \
+  0xda89a6e6, 0xc4b927a0, 0xb0ae2add, 0xccc714dc, 0xd5b3bc4a, 0xeface990, 0x1fae9bf1, 0x1831accf, \
+  0x89acfc63, 0x868ebdc6, 0x7ac84eb8, 0xe86bbb7e, 0x11cc7625, 0xee18fad4, 0x83734175, 0x485910f3, \
+  0x4ca88397, 0x52a95001, 0xc7f08e12, 0x696e9cdd, 0x543f051a, 0xc06e1f16, 0x80457884, 0x010fd713, \
+  /* Point P04 = [0 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                      \
+  0x0b024345, 0xc0cb7f80, 0x70597d6a, 0x72c0b274, 0x8e3d4b24, 0x420c227f, 0x9b3c7c1e, 0x6a74ce1d, \
+  0xbf33834c, 0xb4d7ea11, 0xce76f613, 0x5eb62722, 0xefbe2c62, 0xd3f07ad1, 0x90ab7a27, 0x09995249, \
+  0xbba6dbcd, 0xe2438143, 0x00187c3d, 0x3f63c3cf, 0x89214b89, 0x5d00ce28, 0x1c45593e, 0x37269900, \
+  /* Point P05 = [1 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                      \
+  0xbd0ee9b0, 0x7cfefbb5, 0x628d6074, 0x45313e45, 0xb77bd11d, 0xf0fca8fc, 0x684db263, 0x51f9b5d6, \
+  0xcd9419af, 0x93038b44, 0x5b2bd219, 0x88e9e28a, 0xb6c6a4bd, 0x61c8b396, 0x27169993, 0x3aa7d997, \
+  0x4dd24c38, 0x3bbf3b46, 0x049be5b4, 0x221c4623, 0x85eda439, 0xbc24d6ea, 0x429250f0, 0x4d66f2a1, \
+  /* Point P06 = [0 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                      \
+  0x8d937113, 0x0109fe73, 0x0be01de6, 0x4b2121f6, 0xfd7b2d0f, 0x74c55a6a, 0xe412ffa9, 0x79902773, \
+  0x0af02d8d, 0x4bcf05d2, 0x0d9e5f85, 0xbebcf9a0, 0xcdef01d4, 0xd305ab24, 0x142b0e43, 0x780c301d, \
+  0x1101b969, 0x266ca30c, 0xdfc10963, 0xbddaa02b, 0xb3ad291e, 0x0f2b97d1, 0xb2189a96, 0x37abe341, \
+  /* Point P07 = [1 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                                      \
+  0xf25bdaba, 0x75230f0d, 0x327e4114, 0x66f4b92d, 0xcdc9a3aa, 0x6b2046a6, 0x767679fc, 0x4256f569, \
+  0xa5a8e2e7, 0x9ed13a71, 0x29481fd4, 0x97ff3d63, 0x8839ccad, 0x32514e75, 0x57551a88, 0x7fd9debc, \
+  0x8ed618d3, 0x9e0be274, 0x3531456c, 0x60c7daef, 0x5504d80b, 0x4bb36836, 0xc4044f52, 0x6b096814, \
+  /* Point P08 = [0 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                      \
+  0x4701abe3, 0x95965b65, 0x2923e37c, 0x68a9dcb1, 0x03664222, 0x33317a21, 0x6b4348b2, 0x1278ca02, \
+  0x32a7de52, 0x8db3fa68, 0x09d2a92b, 0x4182424f, 0x8923e1e2, 0x8c2d720a, 0x0e6a35b3, 0x7dfa37d9, \
+  0x422d2b6a, 0xee045df9, 0xadda9c55, 0x049b9a5d, 0xee0b7301, 0x3ca5f892, 0x4bfa414d, 0x722bc831, \
+  /* Point P09 = [1 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                      \
+  0x7b8e4237, 0xbc0b1118, 0xe2dc3fe2, 0xf42a053b, 0x1490b0eb, 0xf9bb5d7b, 0xe6cc9145, 0x73ab47c9, \
+  0xad9a1e70, 0xfa66ee8d, 0x4efec4ee, 0xde528244, 0x8810935a, 0x4f3ffe76, 0x2d64a0eb, 0x0d99f8f2, \
+  0x3642217d, 0x69d97dc3, 0xba09d2c7, 0xb762f0b2, 0xdb8c1457, 0x84280aa8, 0x65e95385, 0x71a36153, \
+  /* Point P10 = [0 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                      \
+  0x9bae7e83, 0x5424c132, 0x84c4ed56, 0x4f08db51, 0x36723ab8, 0x3593109d, 0xdca6165e, 0x6b8b5c93, \
+  0xec4cd8ad, 0x8e7d10c7, 0x5c36a6d2, 0x46cb0d62, 0xf6c2cf0c, 0xe8e65448, 0x2ee281a5, 0x074f85a7, \
+  0xfcf380dd, 0xbba2b671, 0xa00124ac, 0xd3417461, 0x7eba6608, 0xbdd6c477, 0x4ee4462c, 0x1e4763ea, \
+  /* Point P11 = [1 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                                      \
+  0x2efe6cc7, 0xb9f2b1ba, 0x4c957946, 0x4b14dd29, 0x06275f58, 0xc08479fd, 0x7091f87a, 0x36850a7e, \
+  0x2f9ccb07, 0x2c1d06a0, 0x41e4b5ed, 0xd7cf0842, 0x410975b7, 0xee0ae6f9, 0x969c597f, 0x2b1b2496, \
+  0xdfed78c3, 0x64b03df2, 0xfbedf569, 0xd50d17f0, 0x61aa313c, 0x6c81a490, 0x9e9129da, 0x3a2c2abb, \
+  /* Point P12 = [0 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                      \
+  0x80d9c133, 0x2857d375, 0xae01a2d0, 0x12aeb135, 0x869538f3, 0x6fdec1f2, 0xa4096ed8, 0x1e63386d, \
+  0x7008867c, 0x27c68e57, 0x5cbe7f0f, 0x78e3cd30, 0x6910585f, 0x4d5f8d0b, 0x57dd576e, 0x5ef6d5bf, \
+  0x632d206d, 0x7dec45d8, 0x1bf879e9, 0xd76e1c10, 0x0f61c8d5, 0xb88fea8c, 0x832807e4, 0x2387303f, \
+  /* Point P13 = [1 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                      \
+  0x152fa325, 0x5f177afc, 0xb57484fe, 0x61957dcf, 0x1554b792, 0x4ad16fb4, 0xfa1f8f6c, 0x57b81b18, \
+  0xe9f44654, 0xccd9a0a6, 0xb74cbed9, 0x90170e44, 0xb486bc0c, 0xff18b46c, 0x434917a8, 0x05912550, \
+  0xaba4cbb5, 0x6138bf60, 0x319b3132, 0x40c6e690, 0x1c59db37, 0x5ad92c17, 0x1f99bcb2, 0x5b99ebff, \
+  /* Point P14 = [0 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                      \
+  0xd5af079b, 0xe05e58fe, 0x1ae14c08, 0x7f9697a4, 0x6079da20, 0x31a72abc, 0x6c01f05f, 0x791471bb, \
+  0x4cd02b27, 0x0cf0afea, 0xb90745ea, 0xe11e7121, 0x650a76da, 0x99ca8522, 0x22b5a75c, 0x1d589b23, \
+  0xa8b008b7, 0x6869fa12, 0x17465aa0, 0xf1b947df, 0xdfd97cd0, 0x3c329ff1, 0xdfcc9885, 0x06be073f, \
+  /* Point P15 = [1 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                                      \
+  0x86e7a895, 0x9b26cac0, 0xc8cdd651, 0x2263358c, 0xa74cb22f, 0x3c2e890c, 0x7dbd1357, 0x65dca9f5, \
+  0xbaa1e3ac, 0xe7301aa9, 0x8991395c, 0xac123b6c, 0x5f63d925, 0xef2e3559, 0xae6d21f7, 0x2680b928, \
+  0x2a339084, 0x25d1adb1, 0x15363085, 0xc9483555, 0xadc070c0, 0x7c1c244e, 0x3270112f, 0x370d36e5 };
+
+const ECDPARAM CURVE_P255 = {
+  8,
+  19,
+  crvp255_a24,
+  crvp255_dte,
+  crvp255_rma,
+  crvp255_rm1,
+  crvp255_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+#else ////////// CURVE PARAMETERS REPRESENTED WITH 64-BIT WORDS ///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// p = 2^191 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp191_a24[1] = { 0x0000000000000003 };
+
+static const Word crvp191_dte[192/WSIZE] = {                  \
+  0x5555555555555548, 0x5555555555555555, 0x5555555555555555 };
+
+static const Word crvp191_rma[192/WSIZE] = {                  \
+  0x2c6d14519ca4e354, 0x87d66df764ffa597, 0x6cd2d92249889e49 };
+
+static const Word crvp191_rm1[192/WSIZE] = {                  \
+  0xbd7e9efa2231b635, 0xea189a3a6cf80b5c, 0x67097b812847d61c };
+
+static const Word crvp191_tbl[16*3*(192/WSIZE)] = {           \
+  /* Point P00 = [0 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */   \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, \
+  /* Point P01 = [1 + 0*(2^48) + 0*(2^96) + 0*(2^144)]*G */   \
+  0x179e34d3cfa8a7d2, 0x27fce038a791c71c, 0x4057e6e09ba53696, \
+  0x3876f089cc6b0609, 0xa7d16037ebfdee2b, 0x210a0d8cbf2afec1, \
+  0xddc17432276bb81c, 0x43dd49e08dc2f930, 0x7ad7f9209f249bd2, \
+  /* Point P02 = [0 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */   \
+  0x482100e2e16dbcfc, 0x766a68d6305f2114, 0x1f1ae0634ad94278, \
+  0x6b69ef9674d6da18, 0x1ade8c0eee86c627, 0x0e056ff158114317, \
+  0xe00cf1db8bdf16b4, 0xc02c511f1ea81047, 0x6e36f77f5af27ad6, \
+  /* Point P03 = [1 + 1*(2^48) + 0*(2^96) + 0*(2^144)]*G */   \
+  0x5140ded8a0bf093f, 0xa7d1576dec1c360a, 0x5cdb5be46cd31f42, \
+  0x9a87d009c8079b79, 0xd2cfaffbadc5431f, 0x36cc6c7f35badda4, \
+  0xb76fb8e52eb62e59, 0x40e214a76c0abc19, 0x6472fa3ae10c8153, \
+  /* Point P04 = [0 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */   \
+  0x3c771adb928c5944, 0xed7f170a7d05bf82, 0x79bb7bd9cc93fa43, \
+  0x1cd9510246b0a789, 0x3667f5fc79965fae, 0x3df314549be7401c, \
+  0xd8dbed04783b1813, 0x2b54e274dd6562ce, 0x2afd2fce3963a935, \
+  /* Point P05 = [1 + 0*(2^48) + 1*(2^96) + 0*(2^144)]*G */   \
+  0x0b0820e7c3078653, 0x86ffd6de9112a7a3, 0x1236493840a15670, \
+  0x0f5bd4386f83cd34, 0xc15f935a2ba4d9e4, 0x3dd5a8a231be3941, \
+  0x98548236755f4bf4, 0xe77659e24b8ada21, 0x7c2894d4b9a7023a, \
+  /* Point P06 = [0 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */   \
+  0x29361927fcd19f55, 0x27bc817c8c897ed4, 0x28c556f486867d79, \
+  0xea2584f403753919, 0xe8ea16a774580132, 0x2a1f5f35b03cf0b4, \
+  0xf23cb16c590e6b97, 0x6000f2e4f4dc2c82, 0x3c138ce4cabb21e5, \
+  /* Point P07 = [1 + 1*(2^48) + 1*(2^96) + 0*(2^144)]*G */   \
+  0xdec6e2dcc795fbec, 0xccd86939183c0cd5, 0x3ace5fe5f266a86c, \
+  0xc989e2bd235a7ffc, 0x68258a2d9d675e28, 0x1db1df6d088be3c2, \
+  0xac8345af8c54eeeb, 0x611ed0f41ee60406, 0x68f9f3ee64791691, \
+  /* Point P08 = [0 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */   \
+  0x2f82df38dcb8d624, 0xc4004d70ebeffbfc, 0x43356d7458555564, \
+  0xa2be0293aecb5fcb, 0xe4956e13fccc6f57, 0x1031d335dff8f3bb, \
+  0x77e3b8fa6ee3e768, 0xbc7680fc9be5ffbb, 0x2af8483c384c8fcd, \
+  /* Point P09 = [1 + 0*(2^48) + 0*(2^96) + 1*(2^144)]*G */   \
+  0xbe46b9d954845633, 0xa00b87a04c8574db, 0x4b0141f588c90d80, \
+  0x1a513e793905a1f7, 0x482a8ddc6aef325f, 0x763ee75592b89152, \
+  0x079d882ee22cabc2, 0x40936dd31749a637, 0x03c38ce7d2526a71, \
+  /* Point P10 = [0 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */   \
+  0xbe7488382937d695, 0x6b74e768a853c418, 0x1b0dd39494e8f001, \
+  0xc021cf89a7b36486, 0xfe12afd618f27df7, 0x61758a8a22bff8fd, \
+  0xbca2b2c88d71d2a5, 0x66f5a2555120cc45, 0x62154a27fc987af0, \
+  /* Point P11 = [1 + 1*(2^48) + 0*(2^96) + 1*(2^144)]*G */   \
+  0x30dfbaf5ab1bcd43, 0x7d33dddcf122d7ea, 0x66d9cb502d8a2b20, \
+  0x8625bb920e18e47b, 0xb1f58eeb0abe7470, 0x07bdbedb93777bc0, \
+  0x6563e97e3a96982a, 0xc9f762ff5abd48cf, 0x769d973fcf650022, \
+  /* Point P12 = [0 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */   \
+  0xa3f8fa11c8a50fcf, 0x4098478b96b992ba, 0x69fa0ed5700db7b2, \
+  0xd582fcb0a29c9242, 0xa016fdb357ef6539, 0x7ca6f8f7022a7fd9, \
+  0xb612d8fcd8b12733, 0x0a13e42b865bf160, 0x545781222f072045, \
+  /* Point P13 = [1 + 0*(2^48) + 1*(2^96) + 1*(2^144)]*G */   \
+  0x6c897151f756aa17, 0xb99319e95c784ed6, 0x123917088987f88a, \
+  0xc3197459c69fa80d, 0xb87e289190241712, 0x495363e9cea4affa, \
+  0x3bde1d92fbcbc775, 0x1b4dc2c045c2df8a, 0x124975fd4b3a4ceb, \
+  /* Point P14 = [0 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */   \
+  0x375bf72e1c6de07c, 0x47929752832e1a7b, 0x6f79ccd29ec70be7, \
+  0x1e5cd42a67ae523a, 0xe8c55f5ed6a52fc2, 0x74082efe0bd9696a, \
+  0xbfa769f90959edce, 0x6b93a8eb4beece5d, 0x39ccb1cebfd832de, \
+  /* Point P15 = [1 + 1*(2^48) + 1*(2^96) + 1*(2^144)]*G */   \
+  0xbc2c161a0d2b5c78, 0xc3029124245a5578, 0x58733f806026ac84, \
+  0x4f57e22a258041ba, 0xcca83752cc289413, 0x0055e90bc0442f90, \
+  0xeca612a9a600f783, 0x4672aca743416014, 0x683158f1f7fc444a };
+
+const ECDPARAM CURVE_P191 = {
+  3,
+  19,
+  crvp191_a24,
+  crvp191_dte,
+  crvp191_rma,
+  crvp191_rm1,
+  crvp191_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+
+// p = 2^255 - 19, (A+2)/4 = 3, B = 1 (generated by gen_param)
+
+static const Word crvp255_a24[1] = { 0x0000000000000003 };
+
+static const Word crvp255_dte[256/WSIZE] = {                                      \
+  0x5555555555555548, 0x5555555555555555, 0x5555555555555555, 0x5555555555555555 };
+
+static const Word crvp255_rma[256/WSIZE] = {                                      \
+  0xaa1b6276186394f5, 0x686ab6a104e91542, 0x661cbf33156f54a4, 0x6072e8daa99596d7 };
+
+static const Word crvp255_rm1[256/WSIZE] = {                                      \
+  0xc4ee1b274a0ea0b0, 0x2f431806ad2fe478, 0x2b4d00993dfbd7a7, 0x2b8324804fc1df0b };
+
+static const Word crvp255_tbl[16*3*(256/WSIZE)] = {                               \
+  /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, \
+  /* Point P01 = [1 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0x58ae1aed13d0ba78, 0xc3bc2db9d22f231d, 0x19f9ac59f2494a96, 0x699477be5e313ada, \
+  0xa006e66ab4e49b77, 0x58cca2ce968fdc27, 0x2e2d56d2121d1f80, 0x64e9a6dfdc6dbfac, \
+  0x6a6e2b399be26b5e, 0x7d8dbb6a02169ae8, 0xb83290cea6841633, 0x20299131882e498d, \
+  /* Point P02 = [0 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0x95f3aafd0bf5d02e, 0x3cdf776deeb01d48, 0x392e876813258f68, 0x52bc17c6fa86be8c, \
+  0xe8d3242404ebf725, 0x5b45b2b6366d4af1, 0xc7daa97ee231e956, 0x78e4c3f4d59292ba, \
+  0xa8ae157ec0ca281a, 0x44d08053330ce21b, 0xb4ddf7064df04fa4, 0x306f9d5504425035, \
+  /* Point P03 = [1 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0xc4b927a0da89a6e6, 0xccc714dcb0ae2add, 0xeface990d5b3bc4a, 0x1831accf1fae9bf1, \
+  0x868ebdc689acfc63, 0xe86bbb7e7ac84eb8, 0xee18fad411cc7625, 0x485910f383734175, \
+  0x52a950014ca88397, 0x696e9cddc7f08e12, 0xc06e1f16543f051a, 0x010fd71380457884, \
+  /* Point P04 = [0 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0xc0cb7f800b024345, 0x72c0b27470597d6a, 0x420c227f8e3d4b24, 0x6a74ce1d9b3c7c1e, \
+  0xb4d7ea11bf33834c, 0x5eb62722ce76f613, 0xd3f07ad1efbe2c62, 0x0999524990ab7a27, \
+  0xe2438143bba6dbcd, 0x3f63c3cf00187c3d, 0x5d00ce2889214b89, 0x372699001c45593e, \
+  /* Point P05 = [1 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x7cfefbb5bd0ee9b0, 0x45313e45628d6074, 0xf0fca8fcb77bd11d, 0x51f9b5d6684db263, \
+  0x93038b44cd9419af, 0x88e9e28a5b2bd219, 0x61c8b396b6c6a4bd, 0x3aa7d99727169993, \
+  0x3bbf3b464dd24c38, 0x221c4623049be5b4, 0xbc24d6ea85eda439, 0x4d66f2a1429250f0, \
+  /* Point P06 = [0 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x0109fe738d937113, 0x4b2121f60be01de6, 0x74c55a6afd7b2d0f, 0x79902773e412ffa9, \
+  0x4bcf05d20af02d8d, 0xbebcf9a00d9e5f85, 0xd305ab24cdef01d4, 0x780c301d142b0e43, \
+  0x266ca30c1101b969, 0xbddaa02bdfc10963, 0x0f2b97d1b3ad291e, 0x37abe341b2189a96, \
+  /* Point P07 = [1 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x75230f0df25bdaba, 0x66f4b92d327e4114, 0x6b2046a6cdc9a3aa, 0x4256f569767679fc, \
+  0x9ed13a71a5a8e2e7, 0x97ff3d6329481fd4, 0x32514e758839ccad, 0x7fd9debc57551a88, \
+  0x9e0be2748ed618d3, 0x60c7daef3531456c, 0x4bb368365504d80b, 0x6b096814c4044f52, \
+  /* Point P08 = [0 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x95965b654701abe3, 0x68a9dcb12923e37c, 0x33317a2103664222, 0x1278ca026b4348b2, \
+  0x8db3fa6832a7de52, 0x4182424f09d2a92b, 0x8c2d720a8923e1e2, 0x7dfa37d90e6a35b3, \
+  0xee045df9422d2b6a, 0x049b9a5dadda9c55, 0x3ca5f892ee0b7301, 0x722bc8314bfa414d, \
+  /* Point P09 = [1 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0xbc0b11187b8e4237, 0xf42a053be2dc3fe2, 0xf9bb5d7b1490b0eb, 0x73ab47c9e6cc9145, \
+  0xfa66ee8dad9a1e70, 0xde5282444efec4ee, 0x4f3ffe768810935a, 0x0d99f8f22d64a0eb, \
+  0x69d97dc33642217d, 0xb762f0b2ba09d2c7, 0x84280aa8db8c1457, 0x71a3615365e95385, \
+  /* Point P10 = [0 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x5424c1329bae7e83, 0x4f08db5184c4ed56, 0x3593109d36723ab8, 0x6b8b5c93dca6165e, \
+  0x8e7d10c7ec4cd8ad, 0x46cb0d625c36a6d2, 0xe8e65448f6c2cf0c, 0x074f85a72ee281a5, \
+  0xbba2b671fcf380dd, 0xd3417461a00124ac, 0xbdd6c4777eba6608, 0x1e4763ea4ee4462c, \
+  /* Point P11 = [1 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0xb9f2b1ba2efe6cc7, 0x4b14dd294c957946, 0xc08479fd06275f58, 0x36850a7e7091f87a, \
+  0x2c1d06a02f9ccb07, 0xd7cf084241e4b5ed, 0xee0ae6f9410975b7, 0x2b1b2496969c597f, \
+  0x64b03df2dfed78c3, 0xd50d17f0fbedf569, 0x6c81a49061aa313c, 0x3a2c2abb9e9129da, \
+  /* Point P12 = [0 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0x2857d37580d9c133, 0x12aeb135ae01a2d0, 0x6fdec1f2869538f3, 0x1e63386da4096ed8, \
+  0x27c68e577008867c, 0x78e3cd305cbe7f0f, 0x4d5f8d0b6910585f, 0x5ef6d5bf57dd576e, \
+  0x7dec45d8632d206d, 0xd76e1c101bf879e9, 0xb88fea8c0f61c8d5, 0x2387303f832807e4, \
+  /* Point P13 = [1 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0x5f177afc152fa325, 0x61957dcfb57484fe, 0x4ad16fb41554b792, 0x57b81b18fa1f8f6c, \
+  0xccd9a0a6e9f44654, 0x90170e44b74cbed9, 0xff18b46cb486bc0c, 0x05912550434917a8, \
+  0x6138bf60aba4cbb5, 0x40c6e690319b3132, 0x5ad92c171c59db37, 0x5b99ebff1f99bcb2, \
+  /* Point P14 = [0 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0xe05e58fed5af079b, 0x7f9697a41ae14c08, 0x31a72abc6079da20, 0x791471bb6c01f05f, \
+  0x0cf0afea4cd02b27, 0xe11e7121b90745ea, 0x99ca8522650a76da, 0x1d589b2322b5a75c, \
+  0x6869fa12a8b008b7, 0xf1b947df17465aa0, 0x3c329ff1dfd97cd0, 0x06be073fdfcc9885, \
+  /* Point P15 = [1 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0x9b26cac086e7a895, 0x2263358cc8cdd651, 0x3c2e890ca74cb22f, 0x65dca9f57dbd1357, \
+  0xe7301aa9baa1e3ac, 0xac123b6c8991395c, 0xef2e35595f63d925, 0x2680b928ae6d21f7, \
+  0x25d1adb12a339084, 0xc948355515363085, 0x7c1c244eadc070c0, 0x370d36e53270112f };
+
+const ECDPARAM CURVE_P255 = {
+  4,
+  19,
+  crvp255_a24,
+  crvp255_dte,
+  crvp255_rma,
+  crvp255_rm1,
+  crvp255_tbl,
+  NULL,
+  NULL,
+  NULL
+};
+
+#endif  // #if (WSIZE == 16
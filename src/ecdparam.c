@@ -2,10 +2,22 @@
 #include "ecdparam.h"
 
 
+// table of the configurable fixed-base comb (MSPECC_COMB_TEETH teeth and
+// MSPECC_COMB_COMBS combs), which is generated by gen_param (combtbl.c)
+#ifdef MSPECC_COMB_TEETH
+extern const Word crv25519_ctb[];
+#define CRV25519_CTB crv25519_ctb
+#else
+#define CRV25519_CTB NULL
+#endif
+
+
 ///////////////////////////////////////////////////////////////////////////////
 #if (WSIZE == 16) // CURVE PARAMETERS REPRESENTED WITH 16-BIT WORDS ///////////
 ///////////////////////////////////////////////////////////////////////////////
 
+// p = 2^255 - 19, (A+2)/4 = 121666, B = 1
+
 static const Word crv25519_a24[2] = { 0xdb42, 0x0001 };
 
 static const Word crv25519_dte[256/WSIZE] = {                                                                                     \
@@ -17,6 +29,12 @@ static const Word crv25519_rma[256/WSIZE] = {
 static const Word crv25519_rm1[256/WSIZE] = {                                                                                     \
   0xa0b0, 0x4a0e, 0x1b27, 0xc4ee, 0xe478, 0xad2f, 0x1806, 0x2f43, 0xd7a7, 0x3dfb, 0x0099, 0x2b4d, 0xdf0b, 0x4fc1, 0x2480, 0x2b83 };
 
+static const Word crv25519_ord[256/WSIZE] = {                                                                                     \
+  0xd3ed, 0x5cf5, 0x631a, 0x5812, 0x9cd6, 0xa2f7, 0xf9de, 0x14de, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000 };
+
+static const Word crv25519_omu[256/WSIZE+1] = {                                                                                   \
+  0x131b, 0x0a2c, 0xe5a3, 0xed9c, 0x29a7, 0x0863, 0x215d, 0x2106, 0xffeb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x000f };
+
 static const Word crv25519_tbl[16*3*(256/WSIZE)] = {                                                                              \
   /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                                                      \
   0xfff7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3fff, \
@@ -90,14 +108,19 @@ const ECDPARAM CURVE25519 = {
   crv25519_dte,
   crv25519_rma,
   crv25519_rm1,
-  crv25519_tbl
+  crv25519_tbl,
+  CRV25519_CTB,
+  crv25519_ord,
+  crv25519_omu
 };
 
 
 ///////////////////////////////////////////////////////////////////////////////
-#else ////////// CURVE PARAMETERS REPRESENTED WITH 32-BIT WORDS ///////////////
+#elif (WSIZE == 32) // CURVE PARAMETERS REPRESENTED WITH 32-BIT WORDS /////////
 ///////////////////////////////////////////////////////////////////////////////
 
+// p = 2^255 - 19, (A+2)/4 = 121666, B = 1
+
 static const Word crv25519_a24[1] = { 0x0001db42 };
 
 static const Word crv25519_dte[256/WSIZE] = {                                                     \
@@ -109,6 +132,12 @@ static const Word crv25519_rma[256/WSIZE] = {
 static const Word crv25519_rm1[256/WSIZE] = {                                                     \
   0x4a0ea0b0, 0xc4ee1b27, 0xad2fe478, 0x2f431806, 0x3dfbd7a7, 0x2b4d0099, 0x4fc1df0b, 0x2b832480 };
 
+static const Word crv25519_ord[256/WSIZE] = {                                                     \
+  0x5cf5d3ed, 0x5812631a, 0xa2f79cd6, 0x14def9de, 0x00000000, 0x00000000, 0x00000000, 0x10000000 };
+
+static const Word crv25519_omu[256/WSIZE+1] = {                                                   \
+  0x0a2c131b, 0xed9ce5a3, 0x086329a7, 0x2106215d, 0xffffffeb, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000000f };
+
 static const Word crv25519_tbl[16*3*(256/WSIZE)] = {                                              \
   /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                                      \
   0xfffffff7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, \
@@ -182,7 +211,113 @@ const ECDPARAM CURVE25519 = {
   crv25519_dte,
   crv25519_rma,
   crv25519_rm1,
-  crv25519_tbl
+  crv25519_tbl,
+  CRV25519_CTB,
+  crv25519_ord,
+  crv25519_omu
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+#else ////////// CURVE PARAMETERS REPRESENTED WITH 64-BIT WORDS ///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// p = 2^255 - 19, (A+2)/4 = 121666, B = 1
+
+static const Word crv25519_a24[1] = { 0x000000000001db42 };
+
+static const Word crv25519_dte[256/WSIZE] = {                                       \
+  0x75eb4dca135978a3, 0x00700a4d4141d8ab, 0x8cc740797779e898, 0x52036cee2b6ffe73 };
+
+static const Word crv25519_rma[256/WSIZE] = {                                       \
+  0x3391fb5500ba81e7, 0x3a5e2c2eb482e57d, 0x2d84f723fc03b081, 0x70d9120b9f5ff944 };
+
+static const Word crv25519_rm1[256/WSIZE] = {                                       \
+  0xc4ee1b274a0ea0b0, 0x2f431806ad2fe478, 0x2b4d00993dfbd7a7, 0x2b8324804fc1df0b };
+
+static const Word crv25519_ord[256/WSIZE] = {                                       \
+  0x5812631a5cf5d3ed, 0x14def9dea2f79cd6, 0x0000000000000000, 0x1000000000000000 };
+
+static const Word crv25519_omu[256/WSIZE+1] = {                                     \
+  0xed9ce5a30a2c131b, 0x2106215d086329a7, 0xffffffffffffffeb, 0xffffffffffffffff, 0x000000000000000f };
+
+static const Word crv25519_tbl[16*3*(256/WSIZE)] = {                              \
+  /* Point P00 = [0 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0xfffffffffffffff7, 0xffffffffffffffff, 0xffffffffffffffff, 0x3fffffffffffffff, \
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, \
+  /* Point P01 = [1 + 0*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0x97de49e37ac61db9, 0x67c996e37dc6070c, 0x9385a44c321ea161, 0x43e7ce9d19ea5d32, \
+  0xce881c82eba0489f, 0xfe9ccf82e8a05f59, 0xd2e0c21a3447c504, 0x227e97c94c7c0933, \
+  0x55e48902c3bd5534, 0x136cf411e655624f, 0x2d0dbee5eea1acc6, 0x3788bdb44f8632d4, \
+  /* Point P02 = [0 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0xe69532f3bbe8fa81, 0xaa44c8c3c7d53078, 0xd8db9dde6d5e0372, 0x72a43c65d4be64fd, \
+  0xa889c763c6fb587f, 0xa9cbed44f2bafa8d, 0x04903d0eb8bd78dc, 0x10817edd15906b28, \
+  0xcb4f720282ae7347, 0x9b5e53b40928d694, 0x1d0d7a8bd53ed20a, 0x456b92ed94f6595d, \
+  /* Point P03 = [1 + 1*(2^64) + 0*(2^128) + 0*(2^192)]*G */                      \
+  0x002ae2c2b00f2cf4, 0x43c99a15b3240730, 0x9f0a55687f22f226, 0x13756c732409e795, \
+  0xe5badc5b4e423152, 0x16ec37e2b3e98e6b, 0xe68cb9764409a17b, 0x04badacb87e09797, \
+  0x31e79181ed2dd398, 0x025fcec0a978dd37, 0x199bc8685539b3ed, 0x69a33823cefb62f5, \
+  /* Point P04 = [0 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x2c1d825fd656c751, 0x94dba1f40a45f442, 0x158f2c1d840862ed, 0x15aa24f2c759ddd5, \
+  0x2f9d3ab1759edf1a, 0xfbf51c2a475ed05c, 0x8061f298a2ba394c, 0x498274f38b13eaa8, \
+  0xbc4c0a69356e4e7f, 0x1e0dd59fc5a46e85, 0xed07f0fffcbce305, 0x22346f16be16eb49, \
+  /* Point P05 = [1 + 0*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x908c13c6f1de33a4, 0x738ffeb06859077b, 0xfaa8df28e33dd8cc, 0x13509b32682a1ea6, \
+  0x94a9169d89d19cf7, 0xc2a912a8366c4a94, 0x6ff51d6a567a7878, 0x24ebb5dd3ca13a17, \
+  0x0a7d2119c6ab7305, 0x8c8e9ca361a894cd, 0x123eabb6d3d6d8c2, 0x670fd7f1d47e76e1, \
+  /* Point P06 = [0 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x8af3829e91b50226, 0x1e6ede589dc6c3f1, 0x28ccb0696990d414, 0x272acd0787e2ddd2, \
+  0xff00743b4e09380e, 0xcaee6e0501ce1daf, 0x60b4a2a58601758d, 0x393810e9afc3a986, \
+  0x52b8820393ef920f, 0x6fa2f7d55948069b, 0xff376dae30534d6f, 0x327e5b9803dde00e, \
+  /* Point P07 = [1 + 1*(2^64) + 1*(2^128) + 0*(2^192)]*G */                      \
+  0x1c77ac6637e9c865, 0xf7bc32ba8b8d4c7e, 0xc4285bc7e2216b2f, 0x379a6336b7e84377, \
+  0xc9f9e5da1c4c6e02, 0x83c8ffd92183db93, 0xebdec04b671a4c0e, 0x05acc5c745c24fb6, \
+  0x08e7e0c506617b3b, 0x4088a303da94e715, 0x054de0236005aca0, 0x6090945858d63364, \
+  /* Point P08 = [0 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x5336e64ee4060d60, 0x4bd02e7a0d9c521b, 0xd3f5f9df4aedebe3, 0x3ed05c7b46bf3ed5, \
+  0x77bc100a1c2b3ad3, 0xd1324f98557ed4f4, 0xa668f5a82e6fd465, 0x2308ad5d0ea6e059, \
+  0xea078ca9e1daed3b, 0x0ed637b99088cf4d, 0x81e63010ff592cb0, 0x2d2fc43f41b3a5a5, \
+  /* Point P09 = [1 + 0*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x0546b00c065160fa, 0xc0af586de6346fa0, 0x6bf33d23dc17a74c, 0x22d01448303f8ae0, \
+  0x7f79b368fea0f8c2, 0xc5b4a50880e7f08f, 0x259cf0af00a853a6, 0x2009f81eb569a8dd, \
+  0x5e81416e377032e6, 0x1b5cca7e91257323, 0xa9a74d6c7f5e743a, 0x24112ae0ecf83727, \
+  /* Point P10 = [0 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x9e01f567b8e77c00, 0xc81b3aa265457f5d, 0x1c1ff5143514e23b, 0x2742c9d85e32aa31, \
+  0x896f08a551f2b1c6, 0xdd15255494e27906, 0x2b58694ebdc589d1, 0x35dc8d24bdcdbca2, \
+  0x9524f32362f3e903, 0x589f7ce6c931e222, 0xa855b67476d5a94f, 0x1067bebcd875f1cd, \
+  /* Point P11 = [1 + 1*(2^64) + 0*(2^128) + 1*(2^192)]*G */                      \
+  0x65e947a74573ae24, 0x1e6f0148a20005b0, 0x1b9ddce44c5e10b8, 0x3e08c429cfab8443, \
+  0x3eda49cef87f3ee5, 0xfa875c87e5d4a8e7, 0x84c5f30e1abf0e8e, 0x011ab11bc44ca34e, \
+  0x907b77fd70ad25f8, 0x97a3854a1e3bc702, 0xbcfa8501fe4cef33, 0x5c6900c468830a41, \
+  /* Point P12 = [0 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0x11f408d687318ae6, 0x05b28682f1575948, 0x5bdd07acd3aeac36, 0x421f76ea2f0fa6f7, \
+  0x7b60a3f963839902, 0x6328dc8cf9d7e906, 0x12c7edfeb820fc01, 0x4b9e27d4a7a2839f, \
+  0x9eb8f5304946fce2, 0x2dbf3c0319b9ab16, 0x6cd828a6514aa959, 0x0f1538124c9e6239, \
+  /* Point P13 = [1 + 0*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0xb00d07de6a2e4086, 0x925bde3ec9760401, 0x506573158be9203f, 0x6fe5a1f703112d93, \
+  0x988284dc9a84fdd2, 0x86c6d9bb02b18dba, 0xcbef665d29200e43, 0x022324fa08d973b9, \
+  0x06069256cacc10a6, 0x0dbfc813661b3146, 0x99c717aab80b6e75, 0x46450dfd2e6072c7, \
+  /* Point P14 = [0 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0xc6f381dab40e8826, 0x9e97bd2c8931e5a2, 0x5738860b8e72b631, 0x35c2be3f7e61f365, \
+  0x3ce92b5a459400e0, 0xbf4fdf561e2007e2, 0x53a8d58ea399dd20, 0x04ef15faeea0c565, \
+  0x1df887f9f7f83436, 0xaf5d751a78f1bdd1, 0x724f30930eb301a6, 0x6da3371561d92165, \
+  /* Point P15 = [1 + 1*(2^64) + 1*(2^128) + 1*(2^192)]*G */                      \
+  0x89bf75b3a3fddc21, 0x3cefae3ab0408d45, 0x2d15d3b7b8fc644d, 0x04ca952b1de47fe1, \
+  0x515465a5ee3f7c1e, 0xcb5ae37d2fc9e113, 0xea75f58d833271d2, 0x204da56e72e36797, \
+  0x226a9edcc1a1a862, 0xc494c982d2fa82da, 0x7d917d512ca4ff97, 0x34dcb4538232beb2 };
+
+const ECDPARAM CURVE25519 = {
+  4,
+  19,
+  crv25519_a24,
+  crv25519_dte,
+  crv25519_rma,
+  crv25519_rm1,
+  crv25519_tbl,
+  CRV25519_CTB,
+  crv25519_ord,
+  crv25519_omu
 };
 
 #endif  // #if (WSIZE == 16
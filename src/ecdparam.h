@@ -3,23 +3,50 @@
 
 #include "typedefs.h"
 
-extern const ECDPARAM CURVE_P159;  //
-// len   : 10
+// The curves below are Montgomery curves over p = 2^k - c (with p = 5 mod 8)
+// generated by gen_param (gen_param.c). They are BENCHMARK-ONLY parameter
+// sets: neither their group orders nor the orders of their twists have been
+// computed (ord and omu are NULL), so they must not be used for key exchange
+// or signatures. They are therefore not part of the library; their
+// parameters are in ecdbench.c, which only the test and benchmark programs
+// compile (with MSPECC_BENCH_CURVES defined). A curve is only available when
+// k + 1 is a multiple of the Word size.
+
+#ifdef MSPECC_BENCH_CURVES
+
+#if (WSIZE != 64)
+extern const ECDPARAM CURVE_P159;  // benchmark only
+// len   : 160/WSIZE
 // c     : 91
-// a24   : 0xC2CC4
-// ftb   : lfldk
-// base.x: 
-// base.y: 
+// a24   : 0xC2CC4 (B = 2)
+#endif
+
+extern const ECDPARAM CURVE_P191;  // benchmark only
+// len   : 192/WSIZE
+// c     : 19
+// a24   : 3 (B = 1)
 
-extern const ECDPARAM CURVE_P191;  //
+#if (WSIZE == 16)
+extern const ECDPARAM CURVE20791;  // benchmark only
+// len   : 208/WSIZE
+// c     : 91
+// a24   : 3 (B = 1)
+#endif
 
-extern const ECDPARAM CURVE_P223;  //
+#if (WSIZE != 64)
+extern const ECDPARAM CURVE_P223;  // benchmark only
+// len   : 224/WSIZE
+// c     : 235
+// a24   : 3 (B = 1)
+#endif
 
-extern const ECDPARAM CURVE_P255;  //
+extern const ECDPARAM CURVE_P255;  // benchmark only
+// len   : 256/WSIZE
+// c     : 19
+// a24   : 3 (B = 1)
 
-extern const ECDPARAM CURVE20791;  //
+#endif  // MSPECC_BENCH_CURVES
 
 extern const ECDPARAM CURVE25519;  //
 
 #endif
-
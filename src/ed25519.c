@@ -0,0 +1,431 @@
+///////////////////////////////////////////////////////////////////////////////
+// ed25519.c: Ed25519 signature generation and verification (RFC 8032).     //
+// This file is part of SECC430, a Scalable ECC implementation for MSP430.   //
+// Version 1.0.1 (2023-06-24), see <http://www.cryptolux.org/> for updates.  //
+// License: GPLv3 (see LICENSE file), other licenses available upon request. //
+// ------------------------------------------------------------------------- //
+// This program is free software: you can redistribute it and/or modify it   //
+// under the terms of the GNU General Public License as published by the     //
+// Free Software Foundation, either version 3 of the License, or (at your    //
+// option) any later version. This program is distributed in the hope that   //
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied     //
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the  //
+// GNU General Public License for more details. You should have received a   //
+// copy of the GNU General Public License along with this program. If not,   //
+// see <http://www.gnu.org/licenses/>.                                       //
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config.h"
+#include "intarith.h"
+#include "gfparith.h"
+#include "sclarith.h"
+#include "ecdparam.h"
+#include "tedcurve.h"
+#include "sha512.h"
+#include "ed25519.h"
+
+
+// number of Words of field elements and scalars of Curve25519
+#define LEN (256/WSIZE)
+
+// number of signatures that are combined into one equation by the batch
+// verification, which gives two points per signature to the multi-scalar
+// multiplication
+#define ED_BATCH MSPECC_VERIFY_BATCH
+
+// smallest number of points for which the batch verification uses the bucket
+// method (ted_msm) instead of the interleaved method (ted_mul_multi); the
+// bucket method is always used when it can distribute its work among threads
+#if (MSPECC_MSM_THREADS > 1)
+#define ED_MSM_POINTS 0
+#else
+#define ED_MSM_POINTS 256
+#endif
+
+
+/*****************************************************************************/
+/* Conversion of 'n' bytes 'b' in little-endian order into an integer 'r' of */
+/* n/(w/8) Words. Bytes and Words are converted one by one, which means the  */
+/* result does not depend on the endianness of the target.                   */
+/*****************************************************************************/
+
+static void ed_load(Word *r, const uint8_t *b, int n)
+{
+  int i;
+
+  int_set(r, 0, n/(WSIZE/8));
+  for (i = 0; i < n; i++) r[i/(WSIZE/8)] |= ((Word) b[i]) << (8*(i%(WSIZE/8)));
+}
+
+
+/*****************************************************************************/
+/* Conversion of an integer 'a' of n/(w/8) Words into 'n' bytes 'b' in       */
+/* little-endian order.                                                      */
+/*****************************************************************************/
+
+static void ed_store(uint8_t *b, const Word *a, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++) b[i] = (uint8_t) (a[i/(WSIZE/8)] >> (8*(i%(WSIZE/8))));
+}
+
+
+/*****************************************************************************/
+/* Finalize the SHA-512 context 'ctx' and reduce the 64-byte digest, which   */
+/* is interpreted as little-endian integer, modulo the order of the base     */
+/* point.                                                                    */
+/*****************************************************************************/
+
+static void ed_hash_red(Word *r, sha512_s *ctx, const ECDPARAM *m)
+{
+  uint8_t h[SHA512_DIGEST_BYTES];
+  Word t[2*LEN];
+
+  sha512_final(ctx, h);
+  ed_load(t, h, SHA512_DIGEST_BYTES);
+  scl_red(r, t, m);
+}
+
+
+/*****************************************************************************/
+/* Encoding of a point P given in standard affine coordinates (x,y) into 32  */
+/* bytes: the y-coordinate in little-endian order, whereby the most          */
+/* significant bit holds the least significant bit of the x-coordinate (RFC  */
+/* 8032, Section 5.1.2), see ted_compress.                                   */
+/*****************************************************************************/
+
+static void ed_encode(uint8_t *b, const AFFPOINT *p, const ECDPARAM *m)
+{
+  Word t[LEN];
+
+  ted_compress(t, p, m);
+  ed_store(b, t, ED25519_KEY_BYTES);
+}
+
+
+/*****************************************************************************/
+/* Decoding of 32 bytes into a point P in standard affine coordinates (RFC   */
+/* 8032, Section 5.1.3) with a single exponentiation, see ted_decompress.    */
+/* The function returns MSPECC_ERR_INVALID_POINT when y is not smaller than  */
+/* p or there is no x-coordinate for y.                                      */
+/*****************************************************************************/
+
+static int ed_decode(AFFPOINT *p, const uint8_t *b, const ECDPARAM *m)
+{
+  Word t[LEN];
+
+  ed_load(t, b, ED25519_KEY_BYTES);
+  return ted_decompress(p, t, m);
+}
+
+
+/*****************************************************************************/
+/* Derivation of the public key 'pk' (32 bytes) from the secret key 'sk' (32 */
+/* bytes): the lower half of SHA-512(sk) is pruned to a scalar 'a' and the   */
+/* public key is the encoding of a*G, computed by the fixed-base comb.       */
+/*****************************************************************************/
+
+int ed25519_pubkey(uint8_t *pk, const uint8_t *sk)
+{
+  const ECDPARAM *m = &CURVE25519;
+  uint8_t h[SHA512_DIGEST_BYTES];
+  Word a[LEN], x[LEN], y[LEN];
+  AFFPOINT q = { x, y };
+  int err;
+
+  sha512(h, sk, ED25519_KEY_BYTES);
+  h[0] &= 0xF8; h[31] &= 0x7F; h[31] |= 0x40;
+  ed_load(a, h, ED25519_KEY_BYTES);
+  err = ted_mul_fixbase(&q, a, m);
+  if (err != MSPECC_NO_ERROR) return err;
+  ed_encode(pk, &q, m);
+
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Generation of an Ed25519 signature 'sig' (64 bytes) of a message 'msg' of */
+/* 'len' bytes with the secret key 'sk' and the corresponding public key     */
+/* 'pk' (RFC 8032, Section 5.1.6). The nonce r = SHA-512(prefix||msg) mod l  */
+/* is deterministic, R = r*G is computed by the fixed-base comb, and S = r + */
+/* SHA-512(R||pk||msg)*a mod l by the scalar arithmetic of sclarith.c.       */
+/*****************************************************************************/
+
+int ed25519_sign(uint8_t *sig, const uint8_t *msg, size_t len,
+                 const uint8_t *sk, const uint8_t *pk)
+{
+  const ECDPARAM *m = &CURVE25519;
+  uint8_t h[SHA512_DIGEST_BYTES];
+  Word a[LEN], r[LEN], k[LEN], x[LEN], y[LEN];
+  AFFPOINT q = { x, y };
+  sha512_s ctx;
+  int err;
+
+  // secret scalar a and prefix (upper half of the hash of sk)
+  sha512(h, sk, ED25519_KEY_BYTES);
+  h[0] &= 0xF8; h[31] &= 0x7F; h[31] |= 0x40;
+  ed_load(a, h, ED25519_KEY_BYTES);
+
+  // nonce r and R = r*G
+  sha512_init(&ctx);
+  sha512_update(&ctx, &h[32], 32);
+  sha512_update(&ctx, msg, len);
+  ed_hash_red(r, &ctx, m);
+  err = ted_mul_fixbase(&q, r, m);
+  if (err != MSPECC_NO_ERROR) return err;
+  ed_encode(sig, &q, m);
+
+  // S = r + k*a with k = SHA-512(R||pk||msg)
+  sha512_init(&ctx);
+  sha512_update(&ctx, sig, ED25519_KEY_BYTES);
+  sha512_update(&ctx, pk, ED25519_KEY_BYTES);
+  sha512_update(&ctx, msg, len);
+  ed_hash_red(k, &ctx, m);
+  scl_muladd(r, k, a, r, m);
+  ed_store(&sig[32], r, ED25519_KEY_BYTES);
+
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Verification of an Ed25519 signature 'sig' (64 bytes) of a message 'msg'  */
+/* of 'len' bytes with the public key 'pk' (RFC 8032, Section 5.1.7). The    */
+/* point R' = S*G - k*A with k = SHA-512(R||pk||msg) is computed by a single */
+/* double-base scalar multiplication (ted_mul_dblbase with the negated A)    */
+/* and the cofactored equation 8*R = 8*R' is checked, i.e. R - R' is added   */
+/* to the decoded R, doubled three times, and compared with the neutral      */
+/* element. This is the equation of the batch verification, so a signature   */
+/* whose R or A has a small-order component gets the same answer from both   */
+/* (RFC 8032 allows either equation). The function returns MSPECC_NO_ERROR   */
+/* if the signature is valid, MSPECC_ERR_INVALID_POINT if pk can not be      */
+/* decoded, and MSPECC_ERR_INVALID_SIGNATURE otherwise.                      */
+/*****************************************************************************/
+
+int ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t len,
+                   const uint8_t *pk)
+{
+  const ECDPARAM *m = &CURVE25519;
+  Word s[LEN], k[LEN], x[2*LEN], y[2*LEN], tmp[8*LEN], ts[6*LEN];
+  AFFPOINT a = { x, y }, q = { &x[LEN], &y[LEN] };
+  PROPOINT p = { tmp, &tmp[LEN], &tmp[2*LEN], &tmp[3*LEN], &tmp[5*LEN] };
+  PROPOINT e = { ts, &ts[LEN], &ts[2*LEN], NULL, &ts[3*LEN] };
+  DBLSCALAR d = { s, k };
+  sha512_s ctx;
+  int i, err;
+
+  // S must be smaller than the order l (no malleability)
+  ed_load(s, &sig[32], ED25519_KEY_BYTES);
+  if (!scl_isred(s, m)) return MSPECC_ERR_INVALID_SIGNATURE;
+
+  // A is decoded and negated
+  err = ed_decode(&a, pk, m);
+  if (err != MSPECC_NO_ERROR) return err;
+  gfp_cneg(a.x, a.x, m->c, 1, m->len);
+
+  // k = SHA-512(R||pk||msg) mod l and R' = S*G + k*(-A)
+  sha512_init(&ctx);
+  sha512_update(&ctx, sig, ED25519_KEY_BYTES);
+  sha512_update(&ctx, pk, ED25519_KEY_BYTES);
+  sha512_update(&ctx, msg, len);
+  ed_hash_red(k, &ctx, m);
+  err = ted_mul_dblbase(&q, &d, &a, m);
+  if (err != MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+
+  // 8*(R - R') must be the neutral element (X = 0 and Y = Z)
+  err = ed_decode(&a, sig, m);
+  if (err != MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+  gfp_cneg(q.x, q.x, m->c, 1, m->len);
+  ted_aff_to_pro(&p, &a, m);
+  ted_affine_extaff(&e, &q, m);
+  ted_add(&p, &e, m);
+  for (i = 0; i < 3; i++) ted_double(&p, m);
+  gfp_lnr(p.x, p.x, m->c, m->len);
+  if (!int_is0(p.x, m->len) || (gfp_cmp(p.y, p.z, m->c, m->len) != 0)) {
+    return MSPECC_ERR_INVALID_SIGNATURE;
+  }
+
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Check of the batch equation of n <= ED_BATCH signatures: with random      */
+/* 128-bit coefficients z[i], the signatures are valid (up to small-order    */
+/* components) if 8*(sum z[i]*S[i])*G = sum 8*z[i]*R[i] + 8*(z[i]*k[i])*A[i] */
+/* where k[i] = SHA-512(R[i]||A[i]||M[i]). The left side is computed by the  */
+/* fixed-base comb and the right side by a single multi-scalar               */
+/* multiplication (ted_mul_multi or ted_msm) of 2n points. Multiplying by    */
+/* the cofactor 8 removes the small-order components of R[i] and A[i], i.e.  */
+/* the equation is the cofactored one, and the scalars 8*z[i] and            */
+/* 8*(z[i]*k[i] mod l) fit into len Words. The coefficients are derived from */
+/* a hash of all inputs, so that they can not be chosen before the           */
+/* signatures are fixed.                                                     */
+/*****************************************************************************/
+
+static int ed_verify_batch(const uint8_t *const *sig,
+                           const uint8_t *const *msg, const size_t *len,
+                           const uint8_t *const *pk, int n)
+{
+  const ECDPARAM *m = &CURVE25519;
+  uint8_t h[SHA512_DIGEST_BYTES], seed[SHA512_DIGEST_BYTES+4];
+  Word ks[2*ED_BATCH*LEN], xs[2*ED_BATCH*LEN], ys[2*ED_BATCH*LEN];
+  Word s[LEN], z[LEN], sum[LEN], x[2*LEN], y[2*LEN];
+  AFFPOINT pts[2*ED_BATCH];
+  AFFPOINT q = { x, y }, t = { &x[LEN], &y[LEN] };
+  sha512_s ctx, zc;
+  int i, j, err;
+
+  // decoding of R[i] and A[i], k[i] is stored in the scalar of A[i]
+  sha512_init(&zc);
+  for (i = 0; i < n; i++) {
+    ed_load(s, &sig[i][32], ED25519_KEY_BYTES);
+    if (!scl_isred(s, m)) return MSPECC_ERR_INVALID_SIGNATURE;
+    for (j = 2*i; j < 2*i + 2; j++) {
+      pts[j].x = &xs[j*LEN];
+      pts[j].y = &ys[j*LEN];
+    }
+    err = ed_decode(&pts[2*i], sig[i], m);
+    if (err != MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+    err = ed_decode(&pts[2*i+1], pk[i], m);
+    if (err != MSPECC_NO_ERROR) return err;
+    sha512_init(&ctx);
+    sha512_update(&ctx, sig[i], ED25519_KEY_BYTES);
+    sha512_update(&ctx, pk[i], ED25519_KEY_BYTES);
+    sha512_update(&ctx, msg[i], len[i]);
+    ed_hash_red(&ks[(2*i+1)*LEN], &ctx, m);
+    ed_store(h, &ks[(2*i+1)*LEN], ED25519_KEY_BYTES);
+    sha512_update(&zc, sig[i], ED25519_SIG_BYTES);
+    sha512_update(&zc, pk[i], ED25519_KEY_BYTES);
+    sha512_update(&zc, h, ED25519_KEY_BYTES);
+  }
+  sha512_final(&zc, seed);
+
+  // z[i] = SHA-512(seed||i) mod 2^128 and the scalars of the equation
+  int_set(sum, 0, LEN);
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < 4; j++) seed[SHA512_DIGEST_BYTES+j] = (uint8_t) (i >> 8*j);
+    sha512(h, seed, SHA512_DIGEST_BYTES + 4);
+    int_set(z, 0, LEN);
+    ed_load(z, h, 16);
+    ed_load(s, &sig[i][32], ED25519_KEY_BYTES);
+    scl_muladd(sum, z, s, sum, m);
+    scl_mul(&ks[(2*i+1)*LEN], z, &ks[(2*i+1)*LEN], m);
+    int_copy(&ks[2*i*LEN], z, LEN);
+    for (j = 0; j < 3; j++) {
+      int_add(&ks[2*i*LEN], &ks[2*i*LEN], &ks[2*i*LEN], LEN);
+      int_add(&ks[(2*i+1)*LEN], &ks[(2*i+1)*LEN], &ks[(2*i+1)*LEN], LEN);
+    }
+  }
+  int_set(s, 8, LEN);
+  scl_mul(sum, sum, s, m);
+
+  // both sides of the equation
+  err = ted_mul_fixbase(&q, sum, m);
+  if (err != MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+  if (2*n >= ED_MSM_POINTS) err = ted_msm(&t, ks, pts, 2*n, m);
+  else err = ted_mul_multi(&t, ks, pts, 2*n, m);
+  if (err != MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+  if ((int_cmp(q.x, t.x, LEN) != 0) || (int_cmp(q.y, t.y, LEN) != 0)) {
+    return MSPECC_ERR_INVALID_SIGNATURE;
+  }
+
+  return MSPECC_NO_ERROR;
+}
+
+
+static void ed_locate(const uint8_t *const *sig, const uint8_t *const *msg,
+                      const size_t *len, const uint8_t *const *pk, int n,
+                      int *valid);
+
+
+/*****************************************************************************/
+/* Verification of n signatures for which it is not known whether the batch  */
+/* equation holds: if it does, all of them are marked as valid, otherwise    */
+/* the invalid ones are located by ed_locate.                                */
+/*****************************************************************************/
+
+static void ed_check(const uint8_t *const *sig, const uint8_t *const *msg,
+                     const size_t *len, const uint8_t *const *pk, int n,
+                     int *valid)
+{
+  int i;
+
+  if (ed_verify_batch(sig, msg, len, pk, n) == MSPECC_NO_ERROR) {
+    for (i = 0; i < n; i++) valid[i] = 1;
+  } else {
+    ed_locate(sig, msg, len, pk, n, valid);
+  }
+}
+
+
+/*****************************************************************************/
+/* Location of the invalid signatures among n signatures whose batch         */
+/* equation does not hold by binary splitting: when the first half passes,   */
+/* the second one must contain an invalid signature and need not be checked  */
+/* as a whole. Single signatures are verified with ed25519_verify. Hence, t  */
+/* invalid signatures among n cost about 2*t*log2(n) batch equations.        */
+/*****************************************************************************/
+
+static void ed_locate(const uint8_t *const *sig, const uint8_t *const *msg,
+                      const size_t *len, const uint8_t *const *pk, int n,
+                      int *valid)
+{
+  int i, h = n/2;
+
+  if (n == 1) {
+    valid[0] = (ed25519_verify(sig[0], msg[0], len[0], pk[0]) ==
+                MSPECC_NO_ERROR);
+    return;
+  }
+  if (ed_verify_batch(sig, msg, len, pk, h) == MSPECC_NO_ERROR) {
+    for (i = 0; i < h; i++) valid[i] = 1;
+    ed_locate(&sig[h], &msg[h], &len[h], &pk[h], n - h, &valid[h]);
+  } else {
+    ed_locate(sig, msg, len, pk, h, valid);
+    ed_check(&sig[h], &msg[h], &len[h], &pk[h], n - h, &valid[h]);
+  }
+}
+
+
+/*****************************************************************************/
+/* Batch verification of n Ed25519 signatures sig[i] of messages msg[i] of   */
+/* len[i] bytes with the public keys pk[i]. The signatures are checked in    */
+/* groups of ED_BATCH by random linear combinations of their verification    */
+/* equations (see ed_verify_batch), which costs one multi-scalar             */
+/* multiplication per group instead of one double-base scalar multiplication */
+/* per signature. The function returns MSPECC_NO_ERROR if all signatures are */
+/* valid and MSPECC_ERR_INVALID_SIGNATURE otherwise. If 'valid' is not NULL, */
+/* the invalid signatures of a failed group are located (see ed_locate) and  */
+/* valid[i] is set to 1 if sig[i] is valid and to 0 if not. Both this and   */
+/* ed25519_verify check the cofactored equation, so the result for a         */
+/* signature does not depend on the group it is verified in.                 */
+/*****************************************************************************/
+
+int ed25519_verify_batch(const uint8_t *const *sig, const uint8_t *const *msg,
+                         const size_t *len, const uint8_t *const *pk, int n,
+                         int *valid)
+{
+  int i, b, err = MSPECC_NO_ERROR;
+
+  for (i = 0; i < n; i += ED_BATCH) {
+    b = ((n - i) < ED_BATCH) ? (n - i) : ED_BATCH;
+    if (valid == NULL) {
+      if (ed_verify_batch(&sig[i], &msg[i], &len[i], &pk[i], b) !=
+          MSPECC_NO_ERROR) return MSPECC_ERR_INVALID_SIGNATURE;
+      continue;
+    }
+    ed_check(&sig[i], &msg[i], &len[i], &pk[i], b, &valid[i]);
+  }
+  for (i = 0; (valid != NULL) && (i < n); i++) {
+    if (!valid[i]) err = MSPECC_ERR_INVALID_SIGNATURE;
+  }
+
+  return err;
+}
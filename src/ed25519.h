@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////
+// ed25519.h: Function prototypes for Ed25519 signatures (RFC 8032).         //
+// This file is part of SECC430, a Scalable ECC implementation for MSP430.   //
+// Version 1.0.1 (2023-06-24), see <http://www.cryptolux.org/> for updates.  //
+// License: GPLv3 (see LICENSE file), other licenses available upon request. //
+// ------------------------------------------------------------------------- //
+// This program is free software: you can redistribute it and/or modify it   //
+// under the terms of the GNU General Public License as published by the     //
+// Free Software Foundation, either version 3 of the License, or (at your    //
+// option) any later version. This program is distributed in the hope that   //
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied     //
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the  //
+// GNU General Public License for more details. You should have received a   //
+// copy of the GNU General Public License along with this program. If not,   //
+// see <http://www.gnu.org/licenses/>.                                       //
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef _ED25519_H
+#define _ED25519_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "typedefs.h"
+
+/* number of bytes of secret keys, public keys, and signatures */
+#define ED25519_KEY_BYTES 32
+#define ED25519_SIG_BYTES 64
+
+/***********************/
+/* function prototypes */
+/***********************/
+
+int ed25519_pubkey(uint8_t *pk, const uint8_t *sk);
+int ed25519_sign(uint8_t *sig, const uint8_t *msg, size_t len, const uint8_t *sk, const uint8_t *pk);
+int ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t len, const uint8_t *pk);
+int ed25519_verify_batch(const uint8_t *const *sig, const uint8_t *const *msg, const size_t *len, const uint8_t *const *pk, int n, int *valid);
+
+#endif
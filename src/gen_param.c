@@ -0,0 +1,531 @@
+///////////////////////////////////////////////////////////////////////////////
+// gen_param.c: Generator of the domain parameters of a Montgomery curve.    //
+// ------------------------------------------------------------------------- //
+// Usage: gen_param [-w wsize] [-t teeth] [-k combs] [-f uvw|niels] [-u u]   //
+//                  [-o file] <name> <bits> <c> [a24]                        //
+// For the prime p = 2^bits - c (p = 5 mod 8) and the Montgomery curve       //
+// B*v^2 = u^3 + A*u^2 + u with (A+2)/4 = a24, the constants a24, dte, rma,  //
+// rm1 and the 16-point comb table tbl are printed as an ECDPARAM named      //
+// 'name' in the format of ecdparam.c, with 'wsize'-bit Words or, without    //
+// -w, for all Word sizes that divide bits + 1 (in #if (WSIZE == ...)        //
+// blocks). When a24 is omitted, the smallest a24 >= 3 for which             //
+// d = -(A-2)/(A+2) is a non-square (complete addition law) and a24 is a     //
+// square (B = 1) is taken; otherwise B = 2 if a24 is a non-square. The base //
+// point is the point with the given u-coordinate (-u) and an even Edwards   //
+// x-coordinate, or else 8*(u,v) for the smallest u >= 2 on the curve.       //
+// With -t and -k, also the table ctb of the signed comb (see ted_mul_comb)  //
+// with 'teeth' teeth and 'combs' combs is printed, which is selected when   //
+// the library is built with MSPECC_COMB_TEETH = teeth and MSPECC_COMB_COMBS //
+// = combs. With -o, only this table is written to 'file' as a source file   //
+// of the library; the build generates its combtbl.c in this way with        //
+// "-u 9 -t <teeth> -k <combs> -o combtbl.c CURVE25519 255 19 121666".       //
+// The tables are in extended affine coordinates (u,v,w) with u = (x+y)/2,   //
+// v = (y-x)/2, and w = d*x*y, which ted_add expects, or with -f niels in    //
+// the "Niels" form (y+x, y-x, 2*d*x*y) for other implementations (then no   //
+// ECDPARAM is printed). The order of the curve is not computed, i.e. ord    //
+// and omu are NULL. The library must be built with MSPECC_NO_ASM and a Word //
+// size that divides bits + 1; with 16-bit Words (MSPECC_WSIZE = 16), any    //
+// bits + 1 that is a multiple of 16 can be used.                            //
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "intarith.h"
+#include "gfparith.h"
+#include "tedcurve.h"
+#include "ecdparam.h"
+
+
+#define MAXLEN (MSPECC_MAX_LEN/WSIZE)
+
+
+/*------check whether a is a square modulo p, i.e. a^((p-1)/2) = 1------*/
+static int is_square(const Word *a, Word c, int len)
+{
+  Word e[MAXLEN], r[MAXLEN];
+
+  gfp_set(e, c, len);
+  e[0] -= 1;
+  int_shr(e, e, len);
+  gfp_pow(r, a, e, c, len);
+  gfp_lnr(r, r, c, len);
+  int_set(e, 1, len);
+
+  return (int_cmp(r, e, len) == 0);
+}
+
+
+/*------Miller-Rabin test of p = 2^(w*len-1) - c with 12 bases------*/
+static int is_prime(Word c, int len)
+{
+  static const Word base[12] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+  Word d[MAXLEN], a[MAXLEN], x[MAXLEN], one[MAXLEN], pm1[MAXLEN];
+  int i, j, s = 0;
+
+  int_set(one, 1, len);
+  gfp_set(pm1, c, len);
+  pm1[0] -= 1;                          // p - 1 (p is odd)
+  int_copy(d, pm1, len);
+  while ((d[0] & 1) == 0) {
+    int_shr(d, d, len);
+    s++;
+  }
+  for (i = 0; i < 12; i++) {
+    int_set(a, base[i], len);
+    gfp_pow(x, a, d, c, len);
+    gfp_lnr(x, x, c, len);
+    if ((int_cmp(x, one, len) == 0) || (int_cmp(x, pm1, len) == 0)) continue;
+    for (j = 1; j < s; j++) {
+      gfp_sqr(x, x, c, len);
+      gfp_lnr(x, x, c, len);
+      if (int_cmp(x, pm1, len) == 0) break;
+    }
+    if (j == s) return 0;
+  }
+
+  return 1;
+}
+
+
+/*------print a field element with 'wsize'-bit Words------*/
+static void print_gfp(FILE *f, const Word *a, int bits, int wsize,
+                      const char *end)
+{
+  int i, j, nw = (bits + 1)/wsize;
+  uint64_t word;
+
+  fprintf(f, " ");
+  for (i = 0; i < nw; i++) {
+    word = 0;
+    for (j = 0; j < wsize; j += 8) {
+      word |= ((uint64_t) ((a[(i*wsize+j)/WSIZE] >> ((i*wsize+j) % WSIZE))
+              & 0xFF)) << j;
+    }
+    fprintf(f, " 0x%0*llx%s", wsize/4, (unsigned long long) word,
+            (i < nw - 1) ? "," : end);
+  }
+  fprintf(f, "\n");
+}
+
+
+/*------print an array declaration padded to the width of its data------*/
+static void print_decl(FILE *f, const char *decl, int bits, int wsize)
+{
+  int width = 2 + ((bits + 1)/wsize)*(wsize/4 + 4);
+
+  fprintf(f, "%-*s\\\n", width, decl);
+}
+
+
+/*------print a table of 'num' points, each preceded by a comment------*/
+static void print_table(FILE *f, const Word *tbl, int num, int half,
+                        int bits, int wsize, int comb4b)
+{
+  int i, t, b = (bits + 1)/4, width = 2 + ((bits + 1)/wsize)*(wsize/4 + 4);
+  int len = (bits + 1)/WSIZE;
+  char line[128];
+
+  for (i = 0; i < num; i++) {
+    if (comb4b) {
+      sprintf(line, "  /* Point P%02d = [%d + %d*(2^%d) + %d*(2^%d) + "
+              "%d*(2^%d)]*G */", i, i & 1, (i >> 1) & 1, b, (i >> 2) & 1,
+              2*b, (i >> 3) & 1, 3*b);
+    } else {
+      sprintf(line, "  /* Point C%02d,%03d */", i >> half,
+              i & ((1 << half) - 1));
+    }
+    fprintf(f, "%-*s\\\n", width, line);
+    for (t = 0; t < 3; t++) {
+      print_gfp(f, &tbl[(3*i+t)*len], bits, wsize,
+                ((i == num - 1) && (t == 2)) ? " };" : ", \\");
+    }
+  }
+}
+
+
+/*------set r to a constant x < 2^64------*/
+static void set_u64(Word *r, uint64_t x, int len)
+{
+  int i;
+
+  int_set(r, 0, len);
+  for (i = 0; (i < len) && (x != 0); i++) {
+    r[i] = (Word) x;
+    x >>= WSIZE/2;  // two shifts, WSIZE may be 64
+    x >>= WSIZE/2;
+  }
+}
+
+
+/*------comb table of G with 'teeth' teeth and 'combs' combs------*/
+// bas[t*combs+s] = [2^(t*cols+s*e)]*G and nbs[t*combs+s] = -bas[t*combs+s]
+// in extended affine coordinates; an entry of the table is the sum of the
+// bas[t*combs+s] for the bits t set in its index v and, for a signed comb
+// ('sgn' = 1, 2^(teeth-1) entries per comb and the top tooth always set),
+// of the nbs[t*combs+s] for the bits t not set in v (see ted_mul_comb).
+// The entries are in (u,v,w) or, with 'niels' = 1, in (y+x,y-x,2*d*x*y).
+
+static int comb_table(Word *tbl, const AFFPOINT *g, int teeth, int combs,
+                      int sgn, int niels, const ECDPARAM *m)
+{
+  int len = m->len, cols, e, t, s, v, half = sgn ? (teeth - 1) : teeth;
+  Word c = m->c;
+  Word tmp[8*MAXLEN], tx[MAXLEN], ty[MAXLEN], tz[MAXLEN], ts[3*MAXLEN];
+  Word *bas, *nbs;
+  PROPOINT q = { tmp, &tmp[MAXLEN], &tmp[2*MAXLEN], &tmp[3*MAXLEN],
+                 &tmp[5*MAXLEN] };
+  PROPOINT p = { tx, ty, tz, NULL, ts }, r = { NULL, NULL, NULL, NULL, ts };
+  AFFPOINT a = { tx, ty };
+
+  cols = (WSIZE*len + teeth - 1)/teeth;
+  e = (cols + combs - 1)/combs;
+  bas = malloc(3*teeth*combs*len*sizeof(Word));
+  nbs = malloc(3*teeth*combs*len*sizeof(Word));
+  if ((bas == NULL) || (nbs == NULL)) return 1;
+
+  ted_aff_to_pro(&q, g, m);
+  for (v = 0; v <= (teeth - 1)*cols + (combs - 1)*e; v++) {
+    for (t = 0; t < teeth; t++) {
+      s = v - t*cols;
+      if ((s < 0) || (s % e != 0) || (s/e >= combs)) continue;
+      int_copy(tx, q.x, len);
+      int_copy(ty, q.y, len);
+      int_copy(tz, q.z, len);
+      if (ted_proj_affine(&p, &p, m) != MSPECC_NO_ERROR) return 1;
+      r.x = &bas[3*(t*combs+s/e)*len];
+      r.y = r.x + len;
+      r.z = r.x + 2*len;
+      ted_affine_extaff(&r, &a, m);
+      int_copy(&nbs[3*(t*combs+s/e)*len], r.y, len);
+      int_copy(&nbs[(3*(t*combs+s/e)+1)*len], r.x, len);
+      gfp_cneg(&nbs[(3*(t*combs+s/e)+2)*len], r.z, c, 1, len);
+    }
+    ted_double(&q, m);
+  }
+
+  for (s = 0; s < combs; s++) {
+    for (v = 0; v < (1 << half); v++) {
+      int_set(tx, 0, len);  // neutral element (0,1)
+      int_set(ty, 1, len);
+      ted_aff_to_pro(&q, &a, m);
+      for (t = 0; t < teeth; t++) {
+        if (sgn) {
+          r.x = (((v | (1 << (teeth - 1))) >> t) & 1) ? bas : nbs;
+        } else {
+          if (((v >> t) & 1) == 0) continue;
+          r.x = bas;
+        }
+        r.x += 3*(t*combs+s)*len;
+        r.y = r.x + len;
+        r.z = r.x + 2*len;
+        ted_add(&q, &r, m);
+      }
+      if (ted_proj_affine(&q, &q, m) != MSPECC_NO_ERROR) return 1;
+      if (ted_validate(&q, m) != MSPECC_NO_ERROR) return 1;
+      int_copy(tx, q.x, len);
+      int_copy(ty, q.y, len);
+      r.x = &tbl[3*((s << half) + v)*len];
+      r.y = r.x + len;
+      r.z = r.x + 2*len;
+      ted_affine_extaff(&r, &a, m);
+      if (niels) {
+        gfp_add(r.x, r.x, r.x, c, len);
+        gfp_add(r.y, r.y, r.y, c, len);
+        gfp_add(r.z, r.z, r.z, c, len);
+      }
+      gfp_lnr(r.x, r.x, c, len);
+      gfp_lnr(r.y, r.y, c, len);
+      gfp_lnr(r.z, r.z, c, len);
+    }
+  }
+
+  free(bas);
+  free(nbs);
+
+  return 0;
+}
+
+
+/*------write the signed comb table as a source file of the library------*/
+// The file defines the (non-static) array crv<pre>_ctb for the Word size
+// 'wsize' or, with 'wsize' = 0, for all Word sizes that divide bits + 1, and
+// must be compiled with MSPECC_COMB_TEETH = teeth and MSPECC_COMB_COMBS =
+// combs (this is how the build generates combtbl.c for Curve25519).
+
+static int write_ctb(const char *file, const Word *ctb, int teeth, int combs,
+                     const char *name, const char *pre, int bits, int wsize)
+{
+  int i, n = combs << (teeth - 1);
+  char decl[160];
+  FILE *f;
+
+  f = fopen(file, "w");
+  if (f == NULL) return 1;
+  fprintf(f, "// Table of the signed fixed-base comb with %d teeth and %d "
+          "combs for %s.\n// Generated by gen_param, do not edit.\n\n",
+          teeth, combs, name);
+  fprintf(f, "#include \"config.h\"\n\n");
+  fprintf(f, "#if !defined(MSPECC_COMB_TEETH) || (MSPECC_COMB_TEETH != %d) "
+          "|| (MSPECC_COMB_COMBS != %d)\n", teeth, combs);
+  fprintf(f, "#error \"The comb table was generated for %d teeth and %d "
+          "combs!\"\n#endif\n\n", teeth, combs);
+  for (i = 16; i <= 64; i <<= 1) {
+    if (((wsize != 0) && (i != wsize)) || ((bits + 1) % i != 0)) continue;
+    if (wsize == 0) {
+      fprintf(f, "#%s (WSIZE == %d)\n\n", (i == 16) ? "if" : "elif", i);
+    }
+    sprintf(decl, "const Word crv%s_ctb[%d*3*(%d/WSIZE)] = {", pre, n,
+            bits + 1);
+    print_decl(f, decl, bits, i);
+    print_table(f, ctb, n, teeth - 1, bits, i, 0);
+    fprintf(f, "\n");
+  }
+  if (wsize == 0) fprintf(f, "#endif\n");
+
+  return (fclose(f) != 0);
+}
+
+
+int main(int argc, char **argv)
+{
+  int wsize = 0, teeth = 0, combs = 0, niels = 0, bits, len, i, t, n;
+  uint32_t a24, bb;
+  Word c;
+  Word a[MAXLEN], s[MAXLEN], u[MAXLEN], v[MAXLEN], one[MAXLEN];
+  Word dte[MAXLEN], rma[MAXLEN], rm1[MAXLEN];
+  Word tmp[8*MAXLEN], tx[MAXLEN], ty[MAXLEN], tbl[16*3*MAXLEN], *ctb = NULL;
+  PROPOINT q = { tmp, &tmp[MAXLEN], &tmp[2*MAXLEN], &tmp[3*MAXLEN],
+                 &tmp[5*MAXLEN] };
+  AFFPOINT g = { tx, ty };
+  char pre[32], mac[32], decl[160];
+  const char *name, *ubase = NULL, *out = NULL;
+
+  for (i = 1; (i + 1 < argc) && (argv[i][0] == '-'); i += 2) {
+    if (strcmp(argv[i], "-w") == 0) wsize = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-t") == 0) teeth = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-k") == 0) combs = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-u") == 0) ubase = argv[i+1];
+    else if (strcmp(argv[i], "-o") == 0) out = argv[i+1];
+    else if (strcmp(argv[i], "-f") == 0) {
+      niels = (strcmp(argv[i+1], "niels") == 0);
+      if (!niels && (strcmp(argv[i+1], "uvw") != 0)) break;
+    }
+    else break;
+  }
+  if ((argc - i != 3) && (argc - i != 4)) {
+    fprintf(stderr, "usage: %s [-w wsize] [-t teeth] [-k combs] "
+            "[-f uvw|niels] [-u u] [-o file] <name> <bits> <c> [a24]\n",
+            argv[0]);
+    return 1;
+  }
+  name = argv[i];
+  bits = atoi(argv[i+1]);
+  c = (Word) strtoul(argv[i+2], NULL, 0);
+  len = (bits + 1)/WSIZE;
+  if (((bits + 1) % WSIZE != 0) || (bits + 1 > MSPECC_MAX_LEN) ||
+      ((c & 7) != 3) || ((wsize != 0) && (wsize != 16) && (wsize != 32) &&
+      (wsize != 64)) || ((wsize != 0) && ((bits + 1) % wsize != 0))) {
+    fprintf(stderr, "%s: wsize must be 16, 32, or 64 and divide bits + 1 "
+            "(at most %d), c must be 3 mod 8\n", argv[0], MSPECC_MAX_LEN);
+    return 1;
+  }
+  if ((out != NULL) && ((teeth == 0) || niels)) {
+    fprintf(stderr, "%s: -o needs -t and the (u,v,w) format\n", argv[0]);
+    return 1;
+  }
+  if ((teeth != 0) || (combs != 0)) {
+    if (combs == 0) combs = 1;
+    if ((teeth < 2) || (teeth > 12) || (combs < 1) || (combs > 64)) {
+      fprintf(stderr, "%s: teeth must be in [2,12], combs in [1,64]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (!is_prime(c, len)) {
+    fprintf(stderr, "%s: 2^%d - %lu is not prime\n", argv[0], bits,
+            (unsigned long) c);
+    return 1;
+  }
+  int_set(one, 1, len);
+
+  // rm1 = 2^((p-1)/4) is a root of -1 since 2 is a non-square (p = 5 mod 8)
+  gfp_set(s, c, len);
+  s[0] -= 1;
+  int_shr(s, s, len);
+  int_shr(s, s, len);
+  int_set(a, 2, len);
+  gfp_pow(rm1, a, s, c, len);
+  gfp_lnr(rm1, rm1, c, len);
+
+  // a24 and A = 4*a24 - 2 such that A^2 - 4 = (A-2)*(A+2) is a non-square,
+  // B = 1 if a24 is a square (then -(A+2) is a square) and 2 otherwise
+  a24 = (argc - i == 4) ? (uint32_t) strtoul(argv[i+3], NULL, 0) : 3;
+  for (;;) {
+    set_u64(a, 4*((uint64_t) a24) - 2, len);
+    gfp_sqr(u, a, c, len);
+    int_set(v, 4, len);
+    gfp_sub(u, u, v, c, len);
+    set_u64(v, a24, len);
+    bb = is_square(v, c, len) ? 1 : 2;
+    if (!is_square(u, c, len) && ((argc - i == 4) || (bb == 1))) break;
+    if (argc - i == 4) {
+      fprintf(stderr, "%s: d of a24 = %lu is a square\n", argv[0],
+              (unsigned long) a24);
+      return 1;
+    }
+    a24++;
+  }
+
+  // dte = -(A-2)/(A+2) and rma = sqrt(-(A+2)/B)
+  set_u64(u, 4*((uint64_t) a24) - 4, len);
+  set_u64(v, 4*((uint64_t) a24), len);
+  gfp_inv(s, v, c, len);
+  gfp_mul(s, s, u, c, len);
+  gfp_cneg(dte, s, c, 1, len);
+  gfp_lnr(dte, dte, c, len);
+  gfp_cneg(u, v, c, 1, len);
+  int_set(v, (Word) bb, len);
+  if (!gfp_sqrt_ratio(rma, u, v, rm1, c, len)) return 1;
+  gfp_lnr(rma, rma, c, len);
+
+  {
+    ECDPARAM m = { len, c, NULL, dte, rma, rm1, NULL, NULL, NULL, NULL };
+
+    // point (u,v) with the given u or the smallest u >= 2 on the curve,
+    // converted to the twisted Edwards curve with x = rma*u/v and
+    // y = (u-1)/(u+1)
+    set_u64(u, (ubase != NULL) ? strtoull(ubase, NULL, 0) : 2, len);
+    for (;;) {
+      gfp_add(s, u, a, c, len);
+      gfp_mul(s, s, u, c, len);
+      gfp_add(s, s, one, c, len);
+      gfp_mul(s, s, u, c, len);         // s = u^3 + A*u^2 + u
+      int_set(v, (Word) bb, len);
+      if (gfp_sqrt_ratio(v, s, v, rm1, c, len) && !int_is0(v, len)) break;
+      if (ubase != NULL) {
+        fprintf(stderr, "%s: u = %s is not on the curve\n", argv[0], ubase);
+        return 1;
+      }
+      u[0]++;
+    }
+    gfp_inv(s, v, c, len);
+    gfp_mul(s, s, u, c, len);
+    gfp_mul(tx, s, rma, c, len);
+    gfp_add(s, u, one, c, len);
+    gfp_inv(s, s, c, len);
+    gfp_sub(v, u, one, c, len);
+    gfp_mul(ty, v, s, c, len);
+    ted_aff_to_pro(&q, &g, &m);
+    if (ted_validate(&q, &m) != MSPECC_NO_ERROR) return 1;
+
+    // base point G = (u,v) with even x or G = 8*(u,v), which must not be of
+    // small order (8*G != O)
+    if (ubase != NULL) {
+      gfp_lnr(tx, tx, c, len);
+      gfp_cneg(tx, tx, c, tx[0] & 1, len);
+      gfp_lnr(tx, tx, c, len);
+      ted_aff_to_pro(&q, &g, &m);
+    } else {
+      for (i = 0; i < 3; i++) ted_double(&q, &m);
+      if (ted_proj_affine(&q, &q, &m) != MSPECC_NO_ERROR) return 1;
+      int_copy(tx, q.x, len);
+      int_copy(ty, q.y, len);
+    }
+    for (i = 0; i < 3; i++) ted_double(&q, &m);
+    if (int_is0(q.x, len)) {
+      fprintf(stderr, "%s: base point of small order\n", argv[0]);
+      return 1;
+    }
+
+    // 16-point table of ted_mul_comb4b (4 teeth, 1 comb, unsigned) and the
+    // table of ted_mul_comb (signed)
+    if (comb_table(tbl, &g, 4, 1, 0, niels, &m) != 0) return 1;
+    n = (teeth != 0) ? (combs << (teeth - 1)) : 0;
+    if (n != 0) {
+      ctb = malloc(3*n*len*sizeof(Word));
+      if (ctb == NULL) return 1;
+      if (comb_table(ctb, &g, teeth, combs, 1, niels, &m) != 0) return 1;
+    }
+  }
+
+  // prefix of the arrays, e.g. crvp159_ for CURVE_P159, and macro of the
+  // signed comb table, e.g. CRVP159_CTB
+  for (i = 0, t = 0; (name[i] != '\0') && (t < 24); i++) {
+    if (((i < 5) && (name[i] == "CURVE"[i])) || (name[i] == '_')) continue;
+    pre[t] = (char) tolower((unsigned char) name[i]);
+    mac[t++] = (char) toupper((unsigned char) name[i]);
+  }
+  pre[t] = '\0';
+  mac[t] = '\0';
+
+  // with -o, only the signed comb table is written (to a file of its own)
+  if (out != NULL) {
+    i = write_ctb(out, ctb, teeth, combs, name, pre, bits, wsize);
+    free(ctb);
+    return i;
+  }
+
+  for (i = 16; i <= 64; i <<= 1) {
+    if (((wsize != 0) && (i != wsize)) || ((bits + 1) % i != 0)) continue;
+    if (wsize == 0) {
+      printf("#%s (WSIZE == %d)\n\n", (i == 16) ? "if" : "elif", i);
+    }
+    printf("// p = 2^%d - %lu, (A+2)/4 = %lu, B = %lu (generated by "
+           "gen_param)\n", bits, (unsigned long) c, (unsigned long) a24,
+           (unsigned long) bb);
+    if (niels) printf("// tables in Niels form (y+x, y-x, 2*d*x*y)\n");
+    printf("\n");
+    if (i == 16) {
+      printf("static const Word crv%s_a24[2] = { 0x%04lx, 0x%04lx };\n\n",
+             pre, (unsigned long) (a24 & 0xFFFF), (unsigned long) (a24 >> 16));
+    } else {
+      printf("static const Word crv%s_a24[1] = { 0x%0*lx };\n\n", pre, i/4,
+             (unsigned long) a24);
+    }
+    sprintf(decl, "static const Word crv%s_dte[%d/WSIZE] = {", pre, bits + 1);
+    print_decl(stdout, decl, bits, i);
+    print_gfp(stdout, dte, bits, i, " };");
+    printf("\n");
+    sprintf(decl, "static const Word crv%s_rma[%d/WSIZE] = {", pre, bits + 1);
+    print_decl(stdout, decl, bits, i);
+    print_gfp(stdout, rma, bits, i, " };");
+    printf("\n");
+    sprintf(decl, "static const Word crv%s_rm1[%d/WSIZE] = {", pre, bits + 1);
+    print_decl(stdout, decl, bits, i);
+    print_gfp(stdout, rm1, bits, i, " };");
+    printf("\n");
+    sprintf(decl, "static const Word crv%s_tbl[16*3*(%d/WSIZE)] = {", pre,
+            bits + 1);
+    print_decl(stdout, decl, bits, i);
+    print_table(stdout, tbl, 16, 4, bits, i, 1);
+    if (n != 0) {
+      printf("\n#if defined(MSPECC_COMB_TEETH) && (MSPECC_COMB_TEETH == %d) "
+             "&& (MSPECC_COMB_COMBS == %d)\n", teeth, combs);
+      sprintf(decl, "static const Word crv%s_ctb[%d*3*(%d/WSIZE)] = {", pre,
+              n, bits + 1);
+      print_decl(stdout, decl, bits, i);
+      print_table(stdout, ctb, n, teeth - 1, bits, i, 0);
+      printf("#define CRV%s_CTB crv%s_ctb\n#else\n#define CRV%s_CTB NULL\n"
+             "#endif\n", mac, pre, mac);
+    }
+    if (!niels) {
+      printf("\nconst ECDPARAM %s = {\n  %d,\n  %lu,\n", name, (bits + 1)/i,
+             (unsigned long) c);
+      printf("  crv%s_a24,\n  crv%s_dte,\n  crv%s_rma,\n  crv%s_rm1,\n"
+             "  crv%s_tbl,\n", pre, pre, pre, pre, pre);
+      if (n != 0) printf("  CRV%s_CTB,\n", mac);
+      else printf("  NULL,\n");
+      printf("  NULL,\n  NULL\n};\n");
+    }
+    if (wsize == 0) printf("\n");
+  }
+  if (wsize == 0) printf("#endif\n");
+
+  free(ctb);
+
+  return 0;
+}
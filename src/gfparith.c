@@ -9,7 +9,7 @@
 // All-1 Mask: 0xFF..FF
 #define ALL1MASK ((Word) -1L)
 // MSB-1 Mask: 0x80..00
-#define MSB1MASK ((Word) (1UL << (WSIZE - 1)))
+#define MSB1MASK (((Word) 1) << (WSIZE - 1))
 // MSB-0 Mask: 0x7F..FF
 #define MSB0MASK (ALL1MASK >> 1)
 // Minus-4 Mask: 0xFF..FC
@@ -20,6 +20,10 @@
 #define FOURXPMI (((DWord) ALL1MASK) << 2)
 
 
+// number of Words of a 32-bit integer
+#define W32LEN ((32 + WSIZE - 1)/WSIZE)
+
+
 #ifdef MSPECC_USE_VLA  // use variable-length arrays for field elements
 #define _len len       // requires "Allow VLA" in C/C++ Compiler Options
 #else  // use maximum-length arrays
@@ -63,6 +67,21 @@ int gfp_isp(const Word *a, Word c, int len)
 }
 
 
+/*------Conditional swap of two gfp elements (swap is 0 or 1)------*/
+void gfp_cswap(Word *a, Word *b, int swap, int len)
+{
+  Word mask = 0 - ((Word) swap), t;
+  int i;
+  
+  // both elements are always read and written, independent of swap
+  for (i = len - 1; i >= 0; i--) {
+    t = (a[i] ^ b[i]) & mask;
+    a[i] ^= t;
+    b[i] ^= t;
+  }
+}
+
+
 /*------Modular addition------*/
 void gfp_add_c99(Word *r, const Word *a, const Word *b, Word c, int len)
 {
@@ -235,6 +254,118 @@ void gfp_red_c99(Word *r, const Word *a, Word c, int len)
 }
 
 
+#ifdef MSPECC_FIXED_LEN
+
+// The kernels below are inlined into gfp_mul_c99 and gfp_sqr_c99 with the
+// constant len = MSPECC_FIXED_LEN so that the compiler can unroll all loops
+// and keep the column sums of the product-scanning method in registers.
+#if defined(__GNUC__)
+#define FIX_INLINE static inline __attribute__((always_inline))
+#define FIX_UNROLL _Pragma("GCC unroll 32")
+#else
+#define FIX_INLINE static inline
+#define FIX_UNROLL
+#endif
+
+
+/*------Reduction of a product t (2*len words) modulo p=2^(w*len-1)-c------*/
+FIX_INLINE void gfp_red_fix(Word *r, const Word *t, Word c, int len)
+{
+  DWord prod = 0;
+  Word msw, d = (c << 1);
+  int i;
+  
+  // first step of modular reduction
+  FIX_UNROLL
+  for (i = 0; i < len - 1; i++) {
+    prod += (DWord) t[i+len]*d + t[i];
+    r[i] = (Word) prod;
+    prod >>= WSIZE;
+  }
+  prod += (DWord) t[2*len-1]*d + t[len-1];
+  
+  // second step of modular reduction
+  msw = ((Word) prod) & MSB0MASK;  // 0x7F..FF
+  prod = (DWord) c*(prod >> (WSIZE - 1));  // prod is max 2*WSIZE bits long!
+  FIX_UNROLL
+  for (i = 0; i < len - 1; i++) {
+    prod += r[i];
+    r[i] = (Word) prod;
+    prod >>= WSIZE;
+  }
+  r[len-1] = msw + ((Word) prod);
+}
+
+
+/*------Modular multiplication (product scanning, constant len)------*/
+FIX_INLINE void gfp_mul_fix(Word *r, const Word *a, const Word *b, Word c,
+                            int len)
+{
+  Word t[2*MSPECC_FIXED_LEN];
+  DWord prod, lo = 0, hi;
+  int i, k, first, last;
+  
+  // The lower and upper words of the products a[i]*b[k-i] of column k are
+  // summed up separately in lo and hi so that no carries need to be handled
+  // inside the column: both sums (and lo plus the carry from the previous
+  // column) are less than (2*len + 2)*2^w.
+  FIX_UNROLL
+  for (k = 0; k < 2*len - 1; k++) {
+    first = (k < len) ? 0 : (k - len + 1);
+    last = (k < len) ? k : (len - 1);
+    hi = 0;
+    FIX_UNROLL
+    for (i = first; i <= last; i++) {
+      prod = (DWord) a[i]*b[k-i];
+      lo += (Word) prod;
+      hi += prod >> WSIZE;
+    }
+    t[k] = (Word) lo;
+    lo = (lo >> WSIZE) + hi;
+  }
+  t[2*len-1] = (Word) lo;
+  
+  gfp_red_fix(r, t, c, len);
+}
+
+
+/*------Modular squaring (product scanning, constant len)------*/
+FIX_INLINE void gfp_sqr_fix(Word *r, const Word *a, Word c, int len)
+{
+  Word t[2*MSPECC_FIXED_LEN];
+  DWord prod, lo = 0, hi, dlo, dhi;
+  int i, k, first;
+  
+  // column k of the square is twice the sum of the products a[i]*a[k-i]
+  // with i < k-i (summed up in dlo and dhi) plus a[k/2]^2 when k is even
+  FIX_UNROLL
+  for (k = 0; k < 2*len - 1; k++) {
+    first = (k < len) ? 0 : (k - len + 1);
+    dlo = dhi = 0;
+    FIX_UNROLL
+    for (i = first; i < k - i; i++) {
+      prod = (DWord) a[i]*a[k-i];
+      dlo += (Word) prod;
+      dhi += prod >> WSIZE;
+    }
+    lo += dlo << 1;
+    hi = dhi << 1;
+    if ((k & 1) == 0) {
+      prod = (DWord) a[k>>1]*a[k>>1];
+      lo += (Word) prod;
+      hi += prod >> WSIZE;
+    }
+    t[k] = (Word) lo;
+    lo = (lo >> WSIZE) + hi;
+  }
+  t[2*len-1] = (Word) lo;
+  
+  gfp_red_fix(r, t, c, len);
+}
+
+#endif  // MSPECC_FIXED_LEN
+
+
 /*------Modular multiplication------*/
 void gfp_mul_c99(Word *r, const Word *a, const Word *b, Word c, int len)
 {
@@ -243,6 +374,13 @@ void gfp_mul_c99(Word *r, const Word *a, const Word *b, Word c, int len)
   Word msw, d = (c << 1);
   int i, j;
   
+#ifdef MSPECC_FIXED_LEN
+  if (len == MSPECC_FIXED_LEN) {
+    gfp_mul_fix(r, a, b, c, MSPECC_FIXED_LEN);
+    return;
+  }
+#endif
+  
   // multiplication of A by b[0]
   for (j = 0; j < len; j++) {
     prod += (DWord) a[j]*b[0];
@@ -292,6 +430,13 @@ void gfp_sqr_c99(Word *r, const Word *a, Word c, int len)
   Word msw, d = (c << 1);
   int i, j;
   
+#ifdef MSPECC_FIXED_LEN
+  if (len == MSPECC_FIXED_LEN) {
+    gfp_sqr_fix(r, a, c, MSPECC_FIXED_LEN);
+    return;
+  }
+#endif
+  
   // multiplication of A[1,...,len-1] by a[0]
   t[0] = 0;
   for (j = 1; j < len; j++) {
@@ -347,6 +492,26 @@ void gfp_sqr_c99(Word *r, const Word *a, Word c, int len)
 }
 
 
+/*------Modular multiplication (Karatsuba)------*/
+void gfp_mul_kara(Word *r, const Word *a, const Word *b, Word c, int len)
+{
+  Word t[2*_len];
+  
+  int_mul_kara(t, a, b, len);
+  gfp_red_c99(r, t, c, len);
+}
+
+
+/*------Modular squaring (Karatsuba)------*/
+void gfp_sqr_kara(Word *r, const Word *a, Word c, int len)
+{
+  Word t[2*_len];
+  
+  int_sqr_kara(t, a, len);
+  gfp_red_c99(r, t, c, len);
+}
+
+
 /*------Reduction of a (w*len+32)-bit integer------*/
 void gfp_red32_c99(Word *r, const Word *a, Word c, int len)
 {
@@ -358,14 +523,14 @@ void gfp_red32_c99(Word *r, const Word *a, Word c, int len)
   msw = a[len-1] & MSB0MASK;  // 0x7F..FF
   
   // compute first 32 bits of result
-  for (i = 0; i < 32/WSIZE; i++) {
+  for (i = 0; i < W32LEN; i++) {
     prod += (DWord) a[i+len]*d + a[i];
     r[i] = (Word) prod;
     prod >>= WSIZE;
   }
   
   // compute r[i] = t[i] + carry
-  for (i = 32/WSIZE; i < len - 1; i++) {
+  for (i = W32LEN; i < len - 1; i++) {
     prod += (DWord) a[i];
     r[i] = (Word) prod;
     prod >>= WSIZE;
@@ -377,7 +542,7 @@ void gfp_red32_c99(Word *r, const Word *a, Word c, int len)
 /*------Modular Multiplication by 32-bit integer------*/
 void gfp_mul32_c99(Word *r, const Word *a, const Word *b, Word c, int len)
 {
-  Word t[_len+(32/WSIZE)];
+  Word t[_len+W32LEN];
   DWord prod = 0;
   Word msw, d = (c << 1);
   int i, j;
@@ -390,8 +555,8 @@ void gfp_mul32_c99(Word *r, const Word *a, const Word *b, Word c, int len)
   }
   t[j] = (Word) prod;
   
-  // multiplication of A by b[i] for 1 <= i < 32/WSIZE
-  for (i = 1; i < 32/WSIZE; i++) {
+  // multiplication of A by b[i] for 1 <= i < W32LEN
+  for (i = 1; i < W32LEN; i++) {
     prod = 0;
     for (j = 0; j < len; j++) {
       prod += (DWord) a[j]*b[i];
@@ -406,14 +571,14 @@ void gfp_mul32_c99(Word *r, const Word *a, const Word *b, Word c, int len)
   msw = t[len-1] & MSB0MASK;  // 0x7F..FF
   
   // compute first 32 bits of result
-  for (i = 0; i < 32/WSIZE; i++) {
+  for (i = 0; i < W32LEN; i++) {
     prod += (DWord) t[i+len]*d + t[i];
     r[i] = (Word) prod;
     prod >>= WSIZE;
   }
   
   // compute r[i] = t[i] + carry
-  for (i = 32/WSIZE; i < len - 1; i++) {
+  for (i = W32LEN; i < len - 1; i++) {
     prod += (DWord) t[i];
     r[i] = (Word) prod;
     prod >>= WSIZE;
@@ -422,6 +587,278 @@ void gfp_mul32_c99(Word *r, const Word *a, const Word *b, Word c, int len)
 }
 
 
+/*------Modular multiplication by 32-bit integer and addition------*/
+void gfp_mul32add_c99(Word *r, const Word *a, const Word *b, const Word *d,
+                      Word c, int len)
+{
+  Word t[_len+W32LEN];
+  DWord prod = 0;
+  int i, j;
+  
+  // We compute r = a*b + d with a single reduction: the addition of d is
+  // performed on the unreduced product, which can not overflow since a*b + d
+  // <= (2^(w*len)-1)*(2^32-1) + 2^(w*len)-1 < 2^(w*len+32), i.e. the sum has
+  // the same length as the product and gfp_red32_c99 can reduce it. Plain
+  // (non-reducing) additions of field elements are not provided: an output
+  // of the gfp_* functions is below 2^(w*len-1) plus a small amount (e.g.
+  // gfp_add adds a carry of at most 2 and gfp_sub one of at most 5 to the
+  // most significant word, which is at most 0x7F..FF before), so the sum of
+  // two outputs can exceed 2^(w*len) by that amount and not fit len Words.
+  
+  // multiplication of A by b[0] and addition of D
+  for (j = 0; j < len; j++) {
+    prod += (DWord) a[j]*b[0] + d[j];
+    t[j] = (Word) prod;
+    prod >>= WSIZE;
+  }
+  t[j] = (Word) prod;
+  
+  // multiplication of A by b[i] for 1 <= i < W32LEN
+  for (i = 1; i < W32LEN; i++) {
+    prod = 0;
+    for (j = 0; j < len; j++) {
+      prod += (DWord) a[j]*b[i];
+      prod += t[i+j];
+      t[i+j] = (Word) prod;
+      prod >>= WSIZE;
+    }
+    t[i+j] = (Word) prod;
+  }
+  
+  gfp_red32_c99(r, t, c, len);
+}
+
+
+/*------Simultaneous modular addition and subtraction------*/
+static inline void gfp_addsub_c99(Word *s, Word *d, const Word *a,
+                                  const Word *b, Word c, int len)
+{
+  DWord sum;
+  SDWord dif;  // signed!
+  Word msws, mswd;
+  int i;
+  
+  // same computation as gfp_add_c99 and gfp_sub_c99, but a and b are loaded
+  // only once (s and d may be a and b, but must not overlap otherwise)
+  sum = (DWord) a[len-1] + b[len-1];
+  dif = (SDWord) FOURXPHI + a[len-1] - b[len-1];
+  msws = ((Word) sum) & MSB0MASK;
+  mswd = ((Word) dif) & MSB0MASK;
+  sum = (DWord) c*((Word) (sum >> (WSIZE - 1)));
+  dif = (SDWord) c*((Word) (dif >> (WSIZE - 1)));
+  dif = dif - (c << 1) - (c << 1);
+  
+  for (i = 0; i < len - 1; i++) {
+    Word ai = a[i], bi = b[i];
+    sum += (DWord) ai + bi;
+    dif += (SDWord) ai - bi;
+    s[i] = (Word) sum;
+    d[i] = (Word) dif;
+    sum >>= WSIZE;
+    dif = SDWARS(dif, WSIZE);
+  }
+  s[len-1] = msws + ((Word) sum);
+  d[len-1] = mswd + ((Word) dif) + 4;
+}
+
+
+/*------Montgomery ladder step (differential addition and doubling)------*/
+void mon_ladder_step_c99(Word *xz, const Word *x1, const Word *a24, Word c,
+                         int len)
+{
+  Word tmp[4*_len];  // temporary space for four gfp elements
+  Word *x2 = xz, *z2 = &xz[len], *x3 = &xz[2*len], *z3 = &xz[3*len];
+  Word *t0 = tmp, *t1 = &tmp[len], *t2 = &tmp[2*len], *t3 = &tmp[3*len];
+  
+  gfp_addsub_c99(t0, t1, x2, z2, c, len);  // t0 := x2+z2, t1 := x2-z2;
+  gfp_addsub_c99(t2, t3, x3, z3, c, len);  // t2 := x3+z3, t3 := x3-z3;
+  gfp_mul(x3, t3, t0, c, len);             // x3 := t3*t0;
+  gfp_mul(z3, t2, t1, c, len);             // z3 := t2*t1;
+  gfp_sqr(t2, t0, c, len);                 // t2 := t0*t0;
+  gfp_sqr(t3, t1, c, len);                 // t3 := t1*t1;
+  gfp_addsub_c99(t0, t1, x3, z3, c, len);  // t0 := x3+z3, t1 := x3-z3;
+  gfp_sqr(x3, t0, c, len);                 // x3 := t0*t0;
+  gfp_sqr(t0, t1, c, len);                 // t0 := t1*t1;
+  gfp_mul(z3, x1, t0, c, len);             // z3 := x1*t0;
+  gfp_mul(x2, t2, t3, c, len);             // x2 := t2*t3;
+  gfp_sub(t0, t2, t3, c, len);             // t0 := t2-t3;
+  gfp_mul32add(t1, t0, a24, t3, c, len);   // t1 := t0*a24+t3;
+  gfp_mul(z2, t0, t1, c, len);             // z2 := t0*t1;
+}
+
+
+#ifdef MSPECC_USE_R51  // radix-2^51 representation for 255-bit fields
+
+// The field element is split into five limbs of 51 bits, so that products of
+// limbs (and their sums) fit into an unsigned __int128. Carries are propagated
+// only once per multiplication or squaring (lazy carry propagation). Operands
+// and results use the saturated representation of the other gfp functions,
+// the conversion costs only a few shifts per limb.
+
+typedef unsigned __int128 UInt128;
+#define R51MASK 0x7FFFFFFFFFFFFULL  // 2^51 - 1
+// the r51 functions can be used if p = 2^255 - c and c*(2^51+c) < 2^64
+#define R51_USABLE(c, len) (((len)*WSIZE == 256) && ((c) < 4096))
+
+
+/*------Conversion of a 256-bit integer into five 51-bit limbs------*/
+static inline void r51_unpack(uint64_t *l, const Word *a, Word c)
+{
+  uint64_t x[4] = { 0, 0, 0, 0 };
+  int i;
+  
+  // the element has 256/WSIZE words (constant trip count allows unrolling)
+  for (i = 0; i < 256/WSIZE; i++) {
+    x[(i*WSIZE)/64] |= ((uint64_t) a[i]) << ((i*WSIZE)%64);
+  }
+  l[0] = x[0] & R51MASK;
+  l[1] = ((x[0] >> 51) | (x[1] << 13)) & R51MASK;
+  l[2] = ((x[1] >> 38) | (x[2] << 26)) & R51MASK;
+  l[3] = ((x[2] >> 25) | (x[3] << 39)) & R51MASK;
+  l[4] = (x[3] >> 12) & R51MASK;
+  l[0] += c*(x[3] >> 63);  // MSB has weight 2^255 = c mod p
+}
+
+
+/*------Carry propagation and conversion of five 128-bit sums------*/
+static inline void r51_pack(Word *r, UInt128 *t, Word c)
+{
+  uint64_t l[5], x[4];
+  UInt128 sum;
+  int i;
+  
+  // limbs are less than 2^51 afterwards, except l[1] < 2^51 + 2^28
+  t[1] += t[0] >> 51; l[0] = ((uint64_t) t[0]) & R51MASK;
+  t[2] += t[1] >> 51; l[1] = ((uint64_t) t[1]) & R51MASK;
+  t[3] += t[2] >> 51; l[2] = ((uint64_t) t[2]) & R51MASK;
+  t[4] += t[3] >> 51; l[3] = ((uint64_t) t[3]) & R51MASK;
+  sum = (t[4] >> 51)*c + l[0]; l[4] = ((uint64_t) t[4]) & R51MASK;
+  l[0] = ((uint64_t) sum) & R51MASK;
+  l[1] += (uint64_t) (sum >> 51);
+  
+  // result is less than 2^255 + 2^80, i.e. less than 2*p
+  sum = l[0] + (((UInt128) l[1]) << 51);
+  x[0] = (uint64_t) sum; sum >>= 64;
+  sum += ((UInt128) l[2]) << 38;
+  x[1] = (uint64_t) sum; sum >>= 64;
+  sum += ((UInt128) l[3]) << 25;
+  x[2] = (uint64_t) sum; sum >>= 64;
+  sum += ((UInt128) l[4]) << 12;
+  x[3] = (uint64_t) sum;
+  
+  for (i = 0; i < 256/WSIZE; i++) {
+    r[i] = (Word) (x[(i*WSIZE)/64] >> ((i*WSIZE)%64));
+  }
+}
+
+
+/*------Modular multiplication (radix 2^51)------*/
+void gfp_mul_r51(Word *r, const Word *a, const Word *b, Word c, int len)
+{
+  uint64_t x[5], y[5], y1c, y2c, y3c, y4c;
+  UInt128 t[5];
+  
+  if (!R51_USABLE(c, len)) {
+    gfp_mul_c99(r, a, b, c, len);
+    return;
+  }
+  
+  r51_unpack(x, a, c);
+  r51_unpack(y, b, c);
+  y1c = y[1]*c; y2c = y[2]*c; y3c = y[3]*c; y4c = y[4]*c;
+  
+  t[0] = (UInt128) x[0]*y[0] + (UInt128) x[1]*y4c + (UInt128) x[2]*y3c
+       + (UInt128) x[3]*y2c + (UInt128) x[4]*y1c;
+  t[1] = (UInt128) x[0]*y[1] + (UInt128) x[1]*y[0] + (UInt128) x[2]*y4c
+       + (UInt128) x[3]*y3c + (UInt128) x[4]*y2c;
+  t[2] = (UInt128) x[0]*y[2] + (UInt128) x[1]*y[1] + (UInt128) x[2]*y[0]
+       + (UInt128) x[3]*y4c + (UInt128) x[4]*y3c;
+  t[3] = (UInt128) x[0]*y[3] + (UInt128) x[1]*y[2] + (UInt128) x[2]*y[1]
+       + (UInt128) x[3]*y[0] + (UInt128) x[4]*y4c;
+  t[4] = (UInt128) x[0]*y[4] + (UInt128) x[1]*y[3] + (UInt128) x[2]*y[2]
+       + (UInt128) x[3]*y[1] + (UInt128) x[4]*y[0];
+  
+  r51_pack(r, t, c);
+}
+
+
+/*------Modular squaring (radix 2^51)------*/
+void gfp_sqr_r51(Word *r, const Word *a, Word c, int len)
+{
+  uint64_t x[5], x0d, x1d, x3c, x4c;
+  UInt128 t[5];
+  
+  if (!R51_USABLE(c, len)) {
+    gfp_sqr_c99(r, a, c, len);
+    return;
+  }
+  
+  r51_unpack(x, a, c);
+  x0d = x[0] << 1; x1d = x[1] << 1;
+  x3c = x[3]*c; x4c = x[4]*c;
+  
+  t[0] = (UInt128) x[0]*x[0] + (UInt128) x1d*x4c + (UInt128) (x[2] << 1)*x3c;
+  t[1] = (UInt128) x0d*x[1] + (UInt128) (x[2] << 1)*x4c + (UInt128) x[3]*x3c;
+  t[2] = (UInt128) x0d*x[2] + (UInt128) x[1]*x[1] + (UInt128) (x[3] << 1)*x4c;
+  t[3] = (UInt128) x0d*x[3] + (UInt128) x1d*x[2] + (UInt128) x[4]*x4c;
+  t[4] = (UInt128) x0d*x[4] + (UInt128) x1d*x[3] + (UInt128) x[2]*x[2];
+  
+  r51_pack(r, t, c);
+}
+
+
+/*------Modular Multiplication by 32-bit integer (radix 2^51)------*/
+void gfp_mul32_r51(Word *r, const Word *a, const Word *b, Word c, int len)
+{
+  uint64_t x[5], y = 0;
+  UInt128 t[5];
+  int i;
+  
+  if (!R51_USABLE(c, len)) {
+    gfp_mul32_c99(r, a, b, c, len);
+    return;
+  }
+  
+  r51_unpack(x, a, c);
+  for (i = 0; i < W32LEN; i++) {
+    y |= ((uint64_t) b[i]) << (i*WSIZE);
+  }
+  y &= 0xFFFFFFFFULL;
+  for (i = 0; i < 5; i++) t[i] = (UInt128) x[i]*y;
+  
+  r51_pack(r, t, c);
+}
+
+
+/*------Modular Multiplication by 32-bit integer and addition (radix 2^51)------*/
+void gfp_mul32add_r51(Word *r, const Word *a, const Word *b, const Word *d,
+                      Word c, int len)
+{
+  uint64_t x[5], z[5], y = 0;
+  UInt128 t[5];
+  int i;
+  
+  if (!R51_USABLE(c, len)) {
+    gfp_mul32add_c99(r, a, b, d, c, len);
+    return;
+  }
+  
+  r51_unpack(x, a, c);
+  r51_unpack(z, d, c);
+  for (i = 0; i < W32LEN; i++) {
+    y |= ((uint64_t) b[i]) << (i*WSIZE);
+  }
+  y &= 0xFFFFFFFFULL;
+  // limbs of d are added before the carry propagation of r51_pack
+  for (i = 0; i < 5; i++) t[i] = (UInt128) x[i]*y + z[i];
+  
+  r51_pack(r, t, c);
+}
+
+
+#endif  // MSPECC_USE_R51
+
+
 /*------Least non-negative residue------*/
 void gfp_lnr(Word *r, const Word *a, Word c, int len)
 {
@@ -507,3 +944,442 @@ int gfp_inv(Word *r, const Word *a, Word c, int len)
   if (int_is1(ux, len)) int_copy(r, x1, len);
   return MSPECC_NO_ERROR;
 }
+
+
+/*------Repeated modular squaring r = a^(2^n)------*/
+void gfp_sqr_n(Word *r, const Word *a, int n, Word c, int len)
+{
+  Word t[_len];
+  int i;
+  
+  // r and a may be the same array, the squarings alternate between t and r
+  if (n & 1) {
+    gfp_sqr(t, a, c, len);
+    int_copy(r, t, len);
+  } else {
+    int_copy(r, a, len);
+  }
+  for (i = n >> 1; i > 0; i--) {
+    gfp_sqr(t, r, c, len);
+    gfp_sqr(r, t, c, len);
+  }
+}
+
+
+/*------Exponentiation r = a^e mod p for a public exponent e------*/
+// Left-to-right binary method; since e is public, the sequence of squarings
+// and multiplications does not depend on a. The exponent e has len Words.
+void gfp_pow(Word *r, const Word *a, const Word *e, Word c, int len)
+{
+  Word tmp[2*_len];  // temporary space for two gfp elements
+  Word *t0 = tmp, *t1 = &tmp[_len];
+  int i = WSIZE*len - 1;
+  
+  while ((i >= 0) && !((e[i/WSIZE] >> (i%WSIZE)) & 1)) i--;
+  int_set(t0, 1, len);
+  if (i >= 0) int_copy(t0, a, len);
+  for (i--; i >= 0; i--) {
+    gfp_sqr(t1, t0, c, len);
+    if ((e[i/WSIZE] >> (i%WSIZE)) & 1) gfp_mul(t0, t1, a, c, len);
+    else int_copy(t0, t1, len);
+  }
+  int_copy(r, t0, len);
+}
+
+
+/*------Exponentiation r = a^((p-5)/8) mod p for p = 5 mod 8------*/
+// This power yields the square root of u/v as u*v^3*(u*v^7)^((p-5)/8) with a
+// single exponentiation and no inversion (see gfp_sqrt_ratio). For p = 2^255
+// - 19, (p-5)/8 = 2^252 - 3 is computed with the addition chain of the
+// inversion (251 squarings and 11 multiplications), other primes use gfp_pow.
+void gfp_pow22523(Word *r, const Word *a, Word c, int len)
+{
+  Word tmp[4*_len];  // temporary space for four gfp elements
+  Word *t0 = tmp, *t1 = &tmp[_len], *t2 = &tmp[2*_len], *t3 = &tmp[3*_len];
+  
+  if ((len*WSIZE == 256) && (c == 19)) {
+    gfp_sqr(t0, a, c, len);           // t0 = a^2
+    gfp_sqr_n(t1, t0, 2, c, len);     // t1 = a^8
+    gfp_mul(t2, t1, a, c, len);       // t2 = a^9
+    gfp_mul(t3, t2, t0, c, len);      // t3 = a^11
+    gfp_sqr(t0, t3, c, len);          // t0 = a^22
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^5-1)
+    gfp_sqr_n(t0, t1, 5, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^10-1)
+    gfp_sqr_n(t0, t2, 10, c, len);
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^20-1)
+    gfp_sqr_n(t0, t1, 20, c, len);
+    gfp_mul(t3, t0, t1, c, len);      // t3 = a^(2^40-1)
+    gfp_sqr_n(t0, t3, 10, c, len);
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^50-1)
+    gfp_sqr_n(t0, t1, 50, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^100-1)
+    gfp_sqr_n(t0, t2, 100, c, len);
+    gfp_mul(t3, t0, t2, c, len);      // t3 = a^(2^200-1)
+    gfp_sqr_n(t0, t3, 50, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^250-1)
+    gfp_sqr_n(t0, t2, 2, c, len);
+    gfp_mul(r, t0, a, c, len);        // r = a^(2^252-3)
+  } else {
+    gfp_set(t0, c, len);
+    t0[0] -= 5;                       // t0 = p - 5
+    int_shr(t0, t0, len);
+    int_shr(t0, t0, len);
+    int_shr(t0, t0, len);             // t0 = (p - 5)/8
+    gfp_pow(r, a, t0, c, len);
+  }
+}
+
+
+/*------Square root r = sqrt(u/v) mod p for p = 5 mod 8 or p = 3 mod 4------*/
+// The root of u/v is obtained with one exponentiation and no inversion: the
+// candidate x = u*v^3*(u*v^7)^((p-5)/8) for p = 5 mod 8 satisfies v*x^2 = u
+// or v*x^2 = -u (then x is multiplied by the root 'rm1' of -1), whereas x =
+// u*v*(u*v^3)^((p-3)/4) for p = 3 mod 4 satisfies v*x^2 = u only. The return
+// value is 1 if u/v is a square (r is set to one of its roots) and 0 if it is
+// not a square, if v = 0 while u != 0, or if p is 1 mod 8 (r is unchanged).
+int gfp_sqrt_ratio(Word *r, const Word *u, const Word *v, const Word *rm1,
+                   Word c, int len)
+{
+  Word tmp[4*_len];  // temporary space for four gfp elements
+  Word *s = tmp, *t = &tmp[_len], *e = &tmp[2*_len], *x = &tmp[3*_len];
+  
+  if ((c & 7) == 3) {
+    gfp_sqr(t, v, c, len);
+    gfp_mul(e, t, v, c, len);           // e = v^3
+    gfp_mul(s, u, e, c, len);           // s = u*v^3
+    gfp_sqr(t, e, c, len);
+    gfp_mul(x, t, v, c, len);           // x = v^7
+    gfp_mul(t, x, u, c, len);           // t = u*v^7
+    gfp_pow22523(x, t, c, len);
+    gfp_mul(e, x, s, c, len);           // e = candidate root
+  } else if ((c & 3) == 1) {
+    gfp_sqr(t, v, c, len);
+    gfp_mul(e, t, v, c, len);           // e = v^3
+    gfp_mul(s, u, e, c, len);           // s = u*v^3
+    gfp_set(t, c, len);
+    t[0] -= 3;
+    int_shr(t, t, len);
+    int_shr(t, t, len);                 // t = (p - 3)/4
+    gfp_pow(x, s, t, c, len);
+    gfp_mul(t, u, v, c, len);
+    gfp_mul(e, x, t, c, len);           // e = candidate root
+  } else {
+    return 0;
+  }
+  
+  // check v*x^2 = u, or v*x^2 = -u (only possible when p = 5 mod 8)
+  gfp_sqr(t, e, c, len);
+  gfp_mul(s, t, v, c, len);
+  int_copy(t, u, len);
+  if (gfp_cmp(s, t, c, len) != 0) {
+    gfp_cneg(t, u, c, 1, len);
+    if (((c & 7) != 3) || (gfp_cmp(s, t, c, len) != 0)) return 0;
+    gfp_mul(t, e, rm1, c, len);
+    int_copy(e, t, len);
+  }
+  int_copy(r, e, len);
+  
+  return 1;
+}
+
+
+/*------Inversion r = a^(p-2) mod p via Fermat's little theorem------*/
+int gfp_inv_fermat(Word *r, const Word *a, Word c, int len)
+{
+  Word tmp[5*_len];  // temporary space for five gfp elements
+  Word *t0 = tmp, *t1 = &tmp[_len], *t2 = &tmp[2*_len];
+  Word *t3 = &tmp[3*_len], *t4 = &tmp[4*_len];
+  
+  if ((len*WSIZE == 256) && (c == 19)) {
+    // addition chain for p - 2 = 2^255 - 21 (254 squarings, 11 mults)
+    gfp_sqr(t0, a, c, len);           // t0 = a^2
+    gfp_sqr_n(t1, t0, 2, c, len);     // t1 = a^8
+    gfp_mul(t2, t1, a, c, len);       // t2 = a^9
+    gfp_mul(t3, t2, t0, c, len);      // t3 = a^11
+    gfp_sqr(t0, t3, c, len);          // t0 = a^22
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^5-1)
+    gfp_sqr_n(t0, t1, 5, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^10-1)
+    gfp_sqr_n(t0, t2, 10, c, len);
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^20-1)
+    gfp_sqr_n(t0, t1, 20, c, len);
+    gfp_mul(t4, t0, t1, c, len);      // t4 = a^(2^40-1)
+    gfp_sqr_n(t0, t4, 10, c, len);
+    gfp_mul(t1, t0, t2, c, len);      // t1 = a^(2^50-1)
+    gfp_sqr_n(t0, t1, 50, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^100-1)
+    gfp_sqr_n(t0, t2, 100, c, len);
+    gfp_mul(t4, t0, t2, c, len);      // t4 = a^(2^200-1)
+    gfp_sqr_n(t0, t4, 50, c, len);
+    gfp_mul(t2, t0, t1, c, len);      // t2 = a^(2^250-1)
+    gfp_sqr_n(t0, t2, 5, c, len);
+    gfp_mul(r, t0, t3, c, len);       // r = a^(2^255-21)
+  } else {
+    gfp_set(t3, c, len);
+    t3[0] -= 2;                       // t3 = p - 2
+    gfp_pow(r, a, t3, c, len);
+  }
+  
+  // r is 0 (mod p) if and only if a is 0 (mod p)
+  gfp_lnr(t0, r, c, len);
+  if (int_is0(t0, len)) return MSPECC_ERR_INVERSION_ZERO;
+  return MSPECC_NO_ERROR;
+}
+
+
+// The safegcd inversion of Bernstein and Yang ("Fast constant-time gcd
+// computation and modular inversion", TCHES 2019, in the variant of Pieter
+// Wuille with half-delta divsteps) operates on signed integers in radix
+// 2^SGCD_BITS. Hosts with an __int128 use 62-bit digits and 59 divsteps per
+// matrix, other targets 30-bit digits and 30 divsteps per matrix. Limbs are
+// non-negative except the most significant one, which carries the sign. The
+// code relies on right-shifts of signed integers being arithmetic.
+#if defined(__SIZEOF_INT128__) && !defined(MSPECC_SAFEGCD_30BIT)
+typedef int64_t SDigit;            // signed digit
+typedef uint64_t UDigit;           // unsigned digit
+typedef __int128 SDDigit;          // signed double-length digit
+#define SGCD_BITS 62
+#define SGCD_STEPS 59
+#else
+typedef int32_t SDigit;            // signed digit
+typedef uint32_t UDigit;           // unsigned digit
+typedef int64_t SDDigit;           // signed double-length digit
+#define SGCD_BITS 30
+#define SGCD_STEPS 30
+#endif
+#define SGCD_MASK ((SDigit) (((UDigit) -1) >> (8*sizeof(UDigit) - SGCD_BITS)))
+// SGCD_SIGN is all-1 if x is negative, 0 otherwise
+#define SGCD_SIGN(x) ((x) >> (8*sizeof(SDigit) - 1))
+// number of digits of a signed integer of up to MSPECC_MAX_LEN bits
+#define SGCD_LEN (MSPECC_MAX_LEN/SGCD_BITS + 1)
+// 590 divsteps suffice for moduli of up to 256 bits
+#define SGCD_ITER ((590 + SGCD_STEPS - 1)/SGCD_STEPS)
+#if (MSPECC_MAX_LEN > 256)
+#error "Number of divsteps of safegcd inversion must be increased!"
+#endif
+
+
+/*------Conversion of a gfp element into SGCD_LEN signed digits------*/
+static void sgcd_from_gfp(SDigit *s, const Word *a, int len)
+{
+  Word w;
+  int i, j, pos, bits;
+  
+  for (i = 0; i < SGCD_LEN; i++) s[i] = 0;
+  for (j = 0; j < len; j++) {
+    w = a[j]; pos = j*WSIZE; bits = WSIZE;
+    for (;;) {
+      i = pos/SGCD_BITS;
+      s[i] |= ((SDigit) (((UDigit) w) << (pos%SGCD_BITS))) & SGCD_MASK;
+      if (SGCD_BITS - pos%SGCD_BITS >= bits) break;
+      w >>= (SGCD_BITS - pos%SGCD_BITS);
+      bits -= (SGCD_BITS - pos%SGCD_BITS);
+      pos = (i + 1)*SGCD_BITS;
+    }
+  }
+}
+
+
+/*------Conversion of SGCD_LEN non-negative digits into a gfp element------*/
+static void sgcd_to_gfp(Word *r, const SDigit *s, int len)
+{
+  UDigit w;
+  int i, j, pos, bits;
+  
+  for (j = 0; j < len; j++) r[j] = 0;
+  for (i = 0; i < SGCD_LEN; i++) {
+    w = (UDigit) s[i]; pos = i*SGCD_BITS; bits = SGCD_BITS;
+    while (pos < len*WSIZE) {
+      j = pos/WSIZE;
+      r[j] |= ((Word) w) << (pos%WSIZE);
+      if (WSIZE - pos%WSIZE >= bits) break;
+      w >>= (WSIZE - pos%WSIZE);
+      bits -= (WSIZE - pos%WSIZE);
+      pos = (j + 1)*WSIZE;
+    }
+  }
+}
+
+
+/*------SGCD_STEPS divsteps on the least significant digits of f and g------*/
+static SDigit sgcd_divsteps(SDigit zeta, UDigit f, UDigit g, SDigit *t)
+{
+  // transition matrix is scaled by 2^SGCD_BITS after SGCD_STEPS divsteps
+  UDigit u = ((UDigit) 1) << (SGCD_BITS - SGCD_STEPS), v = 0, q = 0;
+  UDigit r = ((UDigit) 1) << (SGCD_BITS - SGCD_STEPS);
+  UDigit mask1, mask2, x, y, z;
+  int i;
+  
+  for (i = 0; i < SGCD_STEPS; i++) {
+    // zeta = -(delta+1/2) is negative iff delta > 0
+    mask1 = (UDigit) SGCD_SIGN(zeta);
+    mask2 = 0 - (g & 1);
+    // conditionally negate f, u, v (when delta > 0)
+    x = (f ^ mask1) - mask1;
+    y = (u ^ mask1) - mask1;
+    z = (v ^ mask1) - mask1;
+    // conditionally add them to g, q, r (when g is odd)
+    g += x & mask2;
+    q += y & mask2;
+    r += z & mask2;
+    // swap (and update zeta) when delta > 0 and g is odd
+    mask1 &= mask2;
+    zeta = (zeta ^ (SDigit) mask1) - 1;
+    f += g & mask1;
+    u += q & mask1;
+    v += r & mask1;
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+  t[0] = (SDigit) u; t[1] = (SDigit) v;
+  t[2] = (SDigit) q; t[3] = (SDigit) r;
+  
+  return zeta;
+}
+
+
+/*------Computation of [f,g] = t*[f,g]/2^SGCD_BITS------*/
+static void sgcd_update_fg(SDigit *f, SDigit *g, const SDigit *t)
+{
+  SDDigit cf, cg;
+  int i;
+  
+  // least significant SGCD_BITS bits of the products are zero
+  cf = (SDDigit) t[0]*f[0] + (SDDigit) t[1]*g[0];
+  cg = (SDDigit) t[2]*f[0] + (SDDigit) t[3]*g[0];
+  cf >>= SGCD_BITS; cg >>= SGCD_BITS;
+  for (i = 1; i < SGCD_LEN; i++) {
+    cf += (SDDigit) t[0]*f[i] + (SDDigit) t[1]*g[i];
+    cg += (SDDigit) t[2]*f[i] + (SDDigit) t[3]*g[i];
+    f[i-1] = ((SDigit) cf) & SGCD_MASK; cf >>= SGCD_BITS;
+    g[i-1] = ((SDigit) cg) & SGCD_MASK; cg >>= SGCD_BITS;
+  }
+  f[SGCD_LEN-1] = (SDigit) cf;
+  g[SGCD_LEN-1] = (SDigit) cg;
+}
+
+
+/*------Computation of [d,e] = t*[d,e]/2^SGCD_BITS mod m------*/
+static void sgcd_update_de(SDigit *d, SDigit *e, const SDigit *t,
+                           const SDigit *m, UDigit minv)
+{
+  SDigit sd, se, md, me;
+  SDDigit cd, ce;
+  int i;
+  
+  // d and e are in (-2*m, m), add m to them when they are negative
+  sd = SGCD_SIGN(d[SGCD_LEN-1]);
+  se = SGCD_SIGN(e[SGCD_LEN-1]);
+  md = (t[0] & sd) + (t[1] & se);
+  me = (t[2] & sd) + (t[3] & se);
+  cd = (SDDigit) t[0]*d[0] + (SDDigit) t[1]*e[0];
+  ce = (SDDigit) t[2]*d[0] + (SDDigit) t[3]*e[0];
+  // correct md and me so that the least significant digit becomes zero
+  md -= (SDigit) ((minv*((UDigit) cd) + (UDigit) md) & SGCD_MASK);
+  me -= (SDigit) ((minv*((UDigit) ce) + (UDigit) me) & SGCD_MASK);
+  cd += (SDDigit) m[0]*md;
+  ce += (SDDigit) m[0]*me;
+  cd >>= SGCD_BITS; ce >>= SGCD_BITS;
+  for (i = 1; i < SGCD_LEN; i++) {
+    cd += (SDDigit) t[0]*d[i] + (SDDigit) t[1]*e[i] + (SDDigit) m[i]*md;
+    ce += (SDDigit) t[2]*d[i] + (SDDigit) t[3]*e[i] + (SDDigit) m[i]*me;
+    d[i-1] = ((SDigit) cd) & SGCD_MASK; cd >>= SGCD_BITS;
+    e[i-1] = ((SDigit) ce) & SGCD_MASK; ce >>= SGCD_BITS;
+  }
+  d[SGCD_LEN-1] = (SDigit) cd;
+  e[SGCD_LEN-1] = (SDigit) ce;
+}
+
+
+/*------Reduction of d from (-2*m, m) to [0, m), negated if f is -1------*/
+static void sgcd_normalize(SDigit *d, SDigit f, const SDigit *m)
+{
+  SDigit mask;
+  int i;
+  
+  // add m if d is negative, then negate d if f is negative
+  mask = SGCD_SIGN(d[SGCD_LEN-1]);
+  for (i = 0; i < SGCD_LEN; i++) d[i] += m[i] & mask;
+  mask = SGCD_SIGN(f);
+  for (i = 0; i < SGCD_LEN; i++) d[i] = (d[i] ^ mask) - mask;
+  for (i = 0; i < SGCD_LEN - 1; i++) {
+    d[i+1] += d[i] >> SGCD_BITS;
+    d[i] &= SGCD_MASK;
+  }
+  // d is in (-m, m) now, add m once more if it is negative
+  mask = SGCD_SIGN(d[SGCD_LEN-1]);
+  for (i = 0; i < SGCD_LEN; i++) d[i] += m[i] & mask;
+  for (i = 0; i < SGCD_LEN - 1; i++) {
+    d[i+1] += d[i] >> SGCD_BITS;
+    d[i] &= SGCD_MASK;
+  }
+}
+
+
+/*------Inversion r = a^(-1) mod p via safegcd (constant time)------*/
+int gfp_inv_sgcd(Word *r, const Word *a, Word c, int len)
+{
+  SDigit f[SGCD_LEN], g[SGCD_LEN], d[SGCD_LEN], e[SGCD_LEN];
+  SDigit m[SGCD_LEN], t[4], zeta = -1;  // zeta = -(delta+1/2), delta = 1/2
+  Word tmp[_len];
+  UDigit minv;
+  int i;
+  
+  // g = a mod p (fully reduced), f = m = p, d = 0, e = 1
+  gfp_lnr(tmp, a, c, len);
+  if (int_is0(tmp, len)) return MSPECC_ERR_INVERSION_ZERO;
+  sgcd_from_gfp(g, tmp, len);
+  gfp_set(tmp, c, len);
+  sgcd_from_gfp(m, tmp, len);
+  for (i = 0; i < SGCD_LEN; i++) { f[i] = m[i]; d[i] = e[i] = 0; }
+  e[0] = 1;
+  
+  // minv = p^(-1) mod 2^SGCD_BITS via Newton iteration (p*p = 1 mod 8)
+  minv = (UDigit) m[0];
+  for (i = 0; i < 5; i++) minv *= 2 - ((UDigit) m[0])*minv;
+  
+  // fixed number of divsteps, g is 0 and f is +1 or -1 afterwards
+  for (i = 0; i < SGCD_ITER; i++) {
+    zeta = sgcd_divsteps(zeta, (UDigit) f[0], (UDigit) g[0], t);
+    sgcd_update_de(d, e, t, m, minv);
+    sgcd_update_fg(f, g, t);
+  }
+  
+  // d = a^(-1) * f, fix the sign and reduce it
+  sgcd_normalize(d, f[SGCD_LEN-1], m);
+  sgcd_to_gfp(r, d, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
+/*------Simultaneous inversion of n elements (Montgomery's trick)------*/
+int gfp_inv_batch(Word *r, const Word *a, int n, Word c, int len)
+{
+  Word tmp[2*_len];  // temporary space for two gfp elements
+  Word *inv = tmp, *t = &tmp[_len];
+  int i, err;
+  
+  // nothing to invert (r is not accessed)
+  if (n <= 0) return MSPECC_NO_ERROR;
+  
+  // r[i] = a[0]*a[1]*...*a[i] (r and a must not overlap)
+  int_copy(r, a, len);
+  for (i = 1; i < n; i++) gfp_mul(&r[i*len], &r[(i-1)*len], &a[i*len], c, len);
+  
+  // one inversion of the product of all elements
+  err = gfp_inv_ct(inv, &r[(n-1)*len], c, len);
+  if (err != MSPECC_NO_ERROR) return err;
+  
+  // r[i] = (a[0]*...*a[i])^(-1) * (a[0]*...*a[i-1]) = a[i]^(-1)
+  for (i = n - 1; i > 0; i--) {
+    gfp_mul(t, inv, &a[i*len], c, len);
+    gfp_mul(&r[i*len], inv, &r[(i-1)*len], c, len);
+    int_copy(inv, t, len);
+  }
+  int_copy(r, inv, len);
+  
+  return MSPECC_NO_ERROR;
+}
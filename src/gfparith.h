@@ -6,6 +6,7 @@
 /* prototypes of functions for which only C implementations exist (no ASM) */
 void gfp_set(Word *r, Word c, int len);
 int  gfp_isp(const Word *a, Word c, int len);
+void gfp_cswap(Word *a, Word *b, int swap, int len);
 
 /* prototypes of functions for which both C and ASM implementations exist  */
 void gfp_add_c99(Word *r, const Word *a, const Word *b, Word c, int len);
@@ -17,11 +18,32 @@ void gfp_mul_c99(Word *r, const Word *a, const Word *b, Word c, int len);
 void gfp_sqr_c99(Word *r, const Word *a, Word c, int len);
 void gfp_red32_c99(Word *r, const Word *a, Word c, int len);
 void gfp_mul32_c99(Word *r, const Word *a, const Word *b, Word c, int len);
+void gfp_mul32add_c99(Word *r, const Word *a, const Word *b, const Word *d, Word c, int len);
+void mon_ladder_step_c99(Word *xz, const Word *x1, const Word *a24, Word c, int len);
+
+/* prototypes of Karatsuba functions (int_mul_kara plus gfp_red_c99)      */
+void gfp_mul_kara(Word *r, const Word *a, const Word *b, Word c, int len);
+void gfp_sqr_kara(Word *r, const Word *a, Word c, int len);
+
+/* prototypes of radix-2^51 functions for 255-bit fields on 64-bit hosts    */
+#ifdef MSPECC_USE_R51
+void gfp_mul_r51(Word *r, const Word *a, const Word *b, Word c, int len);
+void gfp_sqr_r51(Word *r, const Word *a, Word c, int len);
+void gfp_mul32_r51(Word *r, const Word *a, const Word *b, Word c, int len);
+void gfp_mul32add_r51(Word *r, const Word *a, const Word *b, const Word *d, Word c, int len);
+#endif
 
 /* prototypes of functions for which only C implementations exist, but they */
 /* contain sub-functions with C and ASM implementations                     */
 void gfp_lnr(Word *r, const Word *a, Word c, int len);
 int  gfp_cmp(Word *a, Word *b, Word c, int len);
 int  gfp_inv(Word *r, const Word *a, Word c, int len);
+void gfp_sqr_n(Word *r, const Word *a, int n, Word c, int len);
+void gfp_pow(Word *r, const Word *a, const Word *e, Word c, int len);
+void gfp_pow22523(Word *r, const Word *a, Word c, int len);
+int  gfp_sqrt_ratio(Word *r, const Word *u, const Word *v, const Word *rm1, Word c, int len);
+int  gfp_inv_fermat(Word *r, const Word *a, Word c, int len);
+int  gfp_inv_sgcd(Word *r, const Word *a, Word c, int len);
+int  gfp_inv_batch(Word *r, const Word *a, int n, Word c, int len);
 
 #endif
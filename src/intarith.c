@@ -1,5 +1,6 @@
 #include <assert.h>  // assert()
 #include <stdint.h>  // uint32_t
+#include <inttypes.h>  // PRIx64
 #include <stdio.h>   // printf()
 #include <stdlib.h>  // ??
 #include <string.h>  // strlen()
@@ -9,8 +10,28 @@
 // printf() formatstring
 #if (WSIZE == 16)
 #define FORMATSTR "%04x"
-#else  // WSIZE == 32
+#elif (WSIZE == 32)
 #define FORMATSTR "%08x"
+#else  // WSIZE == 64
+#define FORMATSTR "%016" PRIx64
+#endif
+
+
+// number of Words of a 32-bit integer
+#define W32LEN ((32 + WSIZE - 1)/WSIZE)
+
+
+#ifdef MSPECC_USE_VLA  // use variable-length arrays for field elements
+#define _len len       // requires "Allow VLA" in C/C++ Compiler Options
+#else  // use maximum-length arrays
+#define _len (MSPECC_MAX_LEN/WSIZE)
+#endif
+
+// length of the temporary arrays of the Karatsuba functions
+#ifdef MSPECC_USE_VLA
+#define _klen len
+#else
+#define _klen MSPECC_KARA_MAX_LEN
 #endif
 
 
@@ -121,7 +142,7 @@ int int_sub_c99(Word *r, const Word *a, const Word *b, int len)
   int i;
   
   for (i = 0; i < len; i++) {
-    dif += (DWord) a[i] + (~b[i]);
+    dif += (DWord) a[i] + ((Word) ~b[i]);
     r[i] = (Word) dif;
     dif >>= WSIZE;
   }
@@ -174,8 +195,8 @@ void int_mul32_c99(Word *r, const Word *a, const Word *b, int len)
   }
   r[j] = (Word) prod;
   
-  // multiplication of A by b[i] for 1 <= i < 32/WSIZE
-  for (i = 1; i < 32/WSIZE; i++) {
+  // multiplication of A by b[i] for 1 <= i < W32LEN
+  for (i = 1; i < W32LEN; i++) {
     prod = 0;
     for (j = 0; j < len; j++) {
       prod += (DWord) a[j]*b[i];
@@ -230,3 +251,113 @@ void int_sqr_c99(Word *r, const Word *a, int len)
     sum >>= WSIZE;
   }
 }
+
+
+/*------Absolute difference of multiprecision integers------*/
+// r = |a - b| in constant time, returns 1 if a < b and 0 otherwise
+static int int_absdif(Word *r, const Word *a, const Word *b, int len)
+{
+  DWord dif = 1;
+  Word mask;
+  int i, borrow;
+  
+  for (i = 0; i < len; i++) {
+    dif += (DWord) a[i] + ((Word) ~b[i]);
+    r[i] = (Word) dif;
+    dif >>= WSIZE;
+  }
+  borrow = 1 - ((int) dif);
+  
+  // negate r (i.e. r = ~r + 1) if a < b
+  mask = (Word) 0 - (Word) borrow;
+  dif = borrow;
+  for (i = 0; i < len; i++) {
+    dif += (Word) (r[i] ^ mask);
+    r[i] = (Word) dif;
+    dif >>= WSIZE;
+  }
+  
+  return borrow;
+}
+
+
+/*------Karatsuba combination of the three half-length products------*/
+// r[0..len-1] = a0*b0 and r[len..2*len-1] = a1*b1 on entry, m = |a0-a1|*
+// |b0-b1|; the middle part a0*b0 + a1*b1 - (a0-a1)*(b0-b1) (subtraction if
+// mask is all-ones, addition if mask is 0) is added to r at position len/2
+static void int_kara_mid(Word *r, Word *m, Word mask, int len)
+{
+  DWord sum = mask & 1;
+  Word hi;
+  int i, h = len >> 1;
+  
+  // m = a0*b0 + a1*b1 -/+ m is at most 2*WSIZE*h + 1 bits long
+  for (i = 0; i < len; i++) {
+    sum += (DWord) r[i] + r[len+i] + ((Word) (m[i] ^ mask));
+    m[i] = (Word) sum;
+    sum >>= WSIZE;
+  }
+  hi = ((Word) sum) - (mask & 1);
+  
+  // r = r + m*2^(WSIZE*h)
+  sum = 0;
+  for (i = 0; i < len; i++) {
+    sum += (DWord) r[h+i] + m[i];
+    r[h+i] = (Word) sum;
+    sum >>= WSIZE;
+  }
+  sum += hi;
+  for (i = h + len; i < 2*len; i++) {
+    sum += r[i];
+    r[i] = (Word) sum;
+    sum >>= WSIZE;
+  }
+}
+
+
+/*------Multiprecision multiplication (Karatsuba)------*/
+void int_mul_kara(Word *r, const Word *a, const Word *b, int len)
+{
+  Word da[_klen/2], db[_klen/2], m[_klen];
+  Word mask;
+  int h = len >> 1, neg;
+  
+  // assert((r != a) && (r != b));
+  
+  // operands shorter than the threshold (or of odd length) are multiplied
+  // with the schoolbook method (C99 or Assembler)
+  if ((len < MSPECC_KARA_THRESHOLD) || (len & 1)) {
+    int_mul(r, a, b, len);
+    return;
+  }
+  
+  // subtractive Karatsuba: (a0-a1)*(b0-b1) = (-1)^neg*|a0-a1|*|b0-b1|
+  neg = int_absdif(da, a, &a[h], h) ^ int_absdif(db, b, &b[h], h);
+  int_mul_kara(r, a, b, h);
+  int_mul_kara(&r[len], &a[h], &b[h], h);
+  int_mul_kara(m, da, db, h);
+  mask = (Word) neg - 1;  // subtract m if (a0-a1)*(b0-b1) is positive
+  int_kara_mid(r, m, mask, len);
+}
+
+
+/*------Multiprecision squaring (Karatsuba)------*/
+void int_sqr_kara(Word *r, const Word *a, int len)
+{
+  Word da[_klen/2], m[_klen];
+  int h = len >> 1;
+  
+  // assert(r != a);
+  
+  if ((len < MSPECC_KARA_THRESHOLD) || (len & 1)) {
+    int_sqr(r, a, len);
+    return;
+  }
+  
+  // subtractive Karatsuba: 2*a0*a1 = a0^2 + a1^2 - (a0-a1)^2
+  int_absdif(da, a, &a[h], h);
+  int_sqr_kara(r, a, h);
+  int_sqr_kara(&r[len], &a[h], h);
+  int_sqr_kara(m, da, h);
+  int_kara_mid(r, m, (Word) -1L, len);
+}
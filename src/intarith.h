@@ -19,4 +19,9 @@ void int_mul_c99(Word *r, const Word *a, const Word *b, int len);
 void int_mul32_c99(Word *r, const Word *a, const Word *b, int len);
 void int_sqr_c99(Word *r, const Word *a, int len);
 
+/* prototypes of Karatsuba functions (schoolbook int_mul/int_sqr below the */
+/* threshold MSPECC_KARA_THRESHOLD, len <= MSPECC_KARA_MAX_LEN)            */
+void int_mul_kara(Word *r, const Word *a, const Word *b, int len);
+void int_sqr_kara(Word *r, const Word *a, int len);
+
 #endif
@@ -34,11 +34,14 @@
 
 #if (WSIZE == 16)
 #define GET_BIT(k, i) ((k[((i)>>4)] >> ((i) & 0x0F)) & 1)
-#else  // 32 bits
+#elif (WSIZE == 32)
 #define GET_BIT(k, i) ((k[((i)>>5)] >> ((i) & 0x1F)) & 1)
+#else  // 64 bits
+#define GET_BIT(k, i) ((k[((i)>>6)] >> ((i) & 0x3F)) & 1)
 #endif
 
 
+#ifndef MSPECC_USE_CT_INV  // mask for the inversion via gfp_inv
 #if (WSIZE == 16)
 static const Word SECC_INV_MASK[16] = {                           \
   0x5F58, 0xE072, 0x28DB, 0x1703, 0xBC96, 0x22E6, 0x97C4, 0xA158, \
@@ -46,13 +49,50 @@ static const Word SECC_INV_MASK[16] = {                           \
 #if ((MSPECC_MAX_LEN/WSIZE) > 16)
 #error "Multiplicative mask for secure inversion must be extended!"
 #endif // MSPECC_MAX_LEN/WSIZE) > 16)
-#else  // 32 bits
+#elif (WSIZE == 32)
 static const Word SECC_INV_MASK[8] = {            \
   0xE0725F58, 0x170328DB, 0x22E6BC96, 0xA15897C4, \
   0xCED0646A, 0xE6282D36, 0x49089A79, 0x76F94D46  };
 #if ((MSPECC_MAX_LEN/WSIZE) > 8)
 #error "Multiplicative mask for secure inversion must be extended!"
 #endif // MSPECC_MAX_LEN/WSIZE) > 8)
+#else  // 64 bits
+static const Word SECC_INV_MASK[4] = {      \
+  0x170328DBE0725F58, 0xA15897C422E6BC96, \
+  0xE6282D36CED0646A, 0x76F94D4649089A79  };
+#if ((MSPECC_MAX_LEN/WSIZE) > 4)
+#error "Multiplicative mask for secure inversion must be extended!"
+#endif // MSPECC_MAX_LEN/WSIZE) > 4)
+#endif
+#endif  // MSPECC_USE_CT_INV
+
+
+// point of order 8 on the twisted Edwards curve equivalent to Curve25519 in
+// extended affine coordinates (u,v,w), see mon_mul_fixbase_elligator
+#if (WSIZE == 16)
+static const Word SECC_LOW_ORDER[48] = {                          \
+  0xDCB8, 0xAA6D, 0x7C84, 0x4764, 0x52BF, 0x4EED, 0x1631, 0xA659, \
+  0x9548, 0x9F45, 0xB002, 0x1133, 0xC16D, 0xC71D, 0x0686, 0x12E9, \
+  0x0B5B, 0xE528, 0x363D, 0x68C3, 0x7086, 0x3B07, 0xD9C1, 0x4A3F, \
+  0x4A8D, 0x6667, 0x16D0, 0x2800, 0x7744, 0xC0E4, 0x4CE6, 0x7313, \
+  0x3122, 0x6C76, 0xEE38, 0xBC79, 0xC6C9, 0x3757, 0x59ED, 0x211F, \
+  0x565B, 0x900E, 0x029D, 0xC576, 0xD848, 0x84BA, 0xA9C0, 0x1D13 };
+#elif (WSIZE == 32)
+static const Word SECC_LOW_ORDER[24] = {          \
+  0xAA6DDCB8, 0x47647C84, 0x4EED52BF, 0xA6591631, \
+  0x9F459548, 0x1133B002, 0xC71DC16D, 0x12E90686, \
+  0xE5280B5B, 0x68C3363D, 0x3B077086, 0x4A3FD9C1, \
+  0x66674A8D, 0x280016D0, 0xC0E47744, 0x73134CE6, \
+  0x6C763122, 0xBC79EE38, 0x3757C6C9, 0x211F59ED, \
+  0x900E565B, 0xC576029D, 0x84BAD848, 0x1D13A9C0  };
+#else  // 64 bits
+static const Word SECC_LOW_ORDER[12] = {   \
+  0x47647C84AA6DDCB8, 0xA65916314EED52BF, \
+  0x1133B0029F459548, 0x12E90686C71DC16D, \
+  0x68C3363DE5280B5B, 0x4A3FD9C13B077086, \
+  0x280016D066674A8D, 0x73134CE6C0E47744, \
+  0xBC79EE386C763122, 0x211F59ED3757C6C9, \
+  0xC576029D900E565B, 0x1D13A9C084BAD848  };
 #endif
 
 
@@ -119,8 +159,7 @@ void mon_double(PROPOINT *p, const ECDPARAM *m)
   gfp_sqr(zp, t1, c, len);              // zr := t1*t1;
   gfp_mul(xp, t2, zp, c, len);          // xr := t2*zr;
   gfp_sub(t1, t2, zp, c, len);          // t1 := t2-zr;
-  gfp_mul32(t2, t1, m->a24, c, len);    // t2 := t1*a24;
-  gfp_add(t2, t2, zp, c, len);          // t2 := t2+zr;
+  gfp_mul32add(t2, t1, m->a24, zp, c, len); // t2 := t1*a24+zr;
   gfp_mul(zp, t1, t2, c, len);          // zr := t1*t2;
 }
 
@@ -210,13 +249,17 @@ void mon_mul_ladder(PROPOINT *r, const Word *k, const Word *xp,
 
 /*****************************************************************************/
 /* Montgomery ladder for scalar multiplication R = k*P on a Montgomery       */
-/* curve. Only the (affine) x-coordinate of the base point P is needed. The  */
-/* result R is given in projective coordinates of the form (X,Z), i.e. the   */
-/* Y-coordinate is not computed. However, besides the X and Z-coordinate of  */
-/* R = k*P, also the X and Z-coordinate of the point Q = R + P = (k+1)*P is  */
-/* computed by the Montgomery latter. These two coordinates are stored in    */
-/* the Word arrays referenced by the two elements 'y' and 'slack' of the     */
-/* PROPOINT structure representing the result R. The X and Z-coordinate of   */
+/* curve with a constant execution time and a memory access pattern that is */
+/* independent of k. The two points of the ladder are swapped with masks     */
+/* (gfp_cswap) instead of being selected via the bits of k, and the number   */
+/* of ladder steps is fixed to w*len-1 (i.e. 255 for Curve25519), which      */
+/* requires k to be less than 2^(w*len-1) like all X25519 scalars. Only the  */
+/* (affine) x-coordinate of the base point P is needed. The result R is      */
+/* given in projective coordinates of the form (X,Z). Besides the X and      */
+/* Z-coordinate of R = k*P, also the X and Z-coordinate of the point         */
+/* Q = R + P = (k+1)*P is computed. These two coordinates are stored in the  */
+/* Word arrays referenced by the two elements 'y' and 'slack' of the         */
+/* PROPOINT structure representing the result R. The X and Z-coordinate of  */
 /* Q, along with the X and Z-coordinate of R and the affine x and            */
 /* y-coordinate of the base point P, can be used to recover the Y coordinate */
 /* of R.                                                                     */
@@ -225,42 +268,36 @@ void mon_mul_ladder(PROPOINT *r, const Word *k, const Word *xp,
 void mon_mul_ladder_consttime(PROPOINT *r, const Word *k, const Word *xp,
                               const ECDPARAM *m)
 {
-  int i, ki, len = m->len;
-  Word tmp[3*_len]; // temporary space for three gfp elements
-  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, r->slack };
-  PROPOINT *t[2] = { r, &q };
-  
-  // A naive implementation of the Montgomery ladder first scans k to find the
-  // leading "1" and then initializes T[0] with P and T[1] with 2*P. However,
-  // this approach leaks the bitlength of k through the execution time unless
-  // the leading "1" is always at a fixed position. In order to achieve a
-  // constant execution time independent of k, T[0] has to be initialized with
-  // the point at infinity (by setting (X,Z) to (1,0)) and T[1] with P. In this
-  // case, leading "0" bits in k do not change T[0] and T[1], which means the
-  // overall number of loop iterations is always constant, namely 16*'len'.
-  
-  // initialize T[0] with (X,Z) = (1,0)  
-  int_set(t[0]->x, 1, len);
-  int_set(t[0]->z, 0, len);
-  // initialize T[1] with (X,Z) = (xp,1)  
-  int_copy(t[1]->x, xp, len);
-  int_set(t[1]->z, 1, len);
-  
-  // simple left-to-right Montgomery ladder
-  for(i = WSIZE*len - 1; i >= 0; i--) {
+  int i, ki, swap = 0, len = m->len;
+  Word xz[4*_len]; // X and Z-coordinate of R and Q (in this order)
+  
+  // Leading "0" bits of k leave R = (1,0), i.e. the point at infinity, and
+  // Q = P unchanged, which means k does not need to be scanned for its
+  // leading "1" and the number of ladder steps does not depend on k.
+  
+  // initialize R with (X,Z) = (1,0) and Q with (X,Z) = (xp,1)
+  int_set(xz, 1, len);
+  int_set(&xz[len], 0, len);
+  int_copy(&xz[2*len], xp, len);
+  int_set(&xz[3*len], 1, len);
+  
+  // left-to-right Montgomery ladder, R and Q are swapped whenever the bit of
+  // k differs from the previous one (the swaps are "lazily" merged), and the
+  // fused step mon_ladder_step computes Q = R + Q and R = 2*R
+  for (i = WSIZE*len - 2; i >= 0; i--) {
     ki = GET_BIT(k, i);
-    mon_add(t[1-ki], t[ki], xp, m);
-    mon_double(t[ki], m);
+    swap ^= ki;
+    gfp_cswap(xz, &xz[2*len], swap, 2*len);
+    swap = ki;
+    mon_ladder_step(xz, xp, m->a24, m->c, len);
   }
+  gfp_cswap(xz, &xz[2*len], swap, 2*len);
   
-  // At the end of the ladder, the point T[0] contains the X and Z coordinate
-  // of R = k*P, while T[1] contains the X and Z coordinate of T[0]+P, i.e. we
-  // have T[1] = k*P + P = (k+1)*P. These four coordinates, along with the x
-  // and y-coordinate of the base point P, allow a recovery of the Y-coordinate
-  // of R. Hence, we store the X and Z-coordinate of T[1] in the Word arrays
-  // addressed by the pointers 'y' and 'slack' of the PROPOINT structure for R.
-  int_copy(r->y, q.x, len);
-  int_copy(r->slack, q.z, len);
+  // store the X and Z-coordinate of Q = (k+1)*P in 'y' and 'slack' of R
+  int_copy(r->x, xz, len);
+  int_copy(r->z, &xz[len], len);
+  int_copy(r->y, &xz[2*len], len);
+  int_copy(r->slack, &xz[3*len], len);
 }
 
 
@@ -278,6 +315,10 @@ void mon_mul_ladder_consttime(PROPOINT *r, const Word *k, const Word *xp,
 /* obtain Z^-1. This approach for secure inversion is described in Section 6 */
 /* of the paper "SPA Vulnerabilities of the Binary Extended Euclidean        */
 /* Algorithm" (Journal of Cryptographic Engineering, 2016).                  */
+/* When MSPECC_USE_CT_INV is defined, Z is instead inverted with a           */
+/* constant-time algorithm (gfp_inv_ct), i.e. either the safegcd algorithm   */
+/* of Bernstein and Yang (fixed number of divsteps) or exponentiation via    */
+/* Fermat's little theorem; neither of them needs a mask.                    */
 /*****************************************************************************/
 
 int mon_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
@@ -288,11 +329,17 @@ int mon_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
   Word *t1 = r->slack, *prod = &(r->slack[len]);
   (void) prod;  // to silence a warning
   
+#ifdef MSPECC_USE_CT_INV
+  // constant-time inversion of Z (safegcd or Fermat)
+  err = gfp_inv_ct(zr, zp, c, len);
+  if (err != MSPECC_NO_ERROR) return err;
+#else
   // "masked" inversion of Z to thwart timing attacks
   gfp_mul(t1, zp, SECC_INV_MASK, c, len);
   err = gfp_inv(t1, t1, c, len);
   if (err != MSPECC_NO_ERROR) return err;
   gfp_mul(zr, t1, SECC_INV_MASK, c, len);
+#endif
   
   // get least non-negative residue of x = X*(1/Z)
   gfp_mul(t1, xp, zr, c, len);
@@ -366,16 +413,20 @@ int mon_mul_varbase(Word *r, const Word *k, const Word *xp,
   Word tmp[6*_len]; // temporary space for six gfp elements
   PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, &tmp[3*len] };  
   
-  // set r to 0 when k is 0 (should normally never happen)
-  if (int_is0(k, len)) { int_set(r, 0, len); return MSPECC_ERR_INVALID_SCALAR; }
+  // set r to 0 when k is 0 or k >= 2^(w*len-1), which the ladder does not
+  // support (should normally never happen since scalars are "clamped")
+  if (int_is0(k, len) | (k[len-1] >> (WSIZE-1))) {
+    int_set(r, 0, len);
+    return MSPECC_ERR_INVALID_SCALAR;
+  }
   
   // check the order of P to prevent the attack described in "To Infinity and
   // Beyond: Combined Attack on ECC Using Points of Low Order" (CHES 2011)
   // err = mon_check_order(&q, xp, m);
   // if (err != MSPECC_NO_ERROR) { int_set(r, 0, len); return err; }
   
-  // perform the scalar multiplication (Montgomery ladder)
-  mon_mul_ladder(&q, k, xp, m);
+  // perform the scalar multiplication (constant-time Montgomery ladder)
+  mon_mul_ladder_consttime(&q, k, xp, m);
   
   // convert result from projective to affine coordinates
   err = mon_proj_affine(&q, &q, m);
@@ -388,38 +439,355 @@ int mon_mul_varbase(Word *r, const Word *k, const Word *xp,
 }
 
 
+/*****************************************************************************/
+/* Conversion of a point P on a twisted Edwards curve, given in (extended)   */
+/* projective coordinates, into the affine x-coordinate u = (Z+Y)/(Z-Y) of   */
+/* the corresponding point on the Montgomery curve. The inversion of Z-Y is  */
+/* either constant-time or "masked" to thwart timing attacks. The X and the  */
+/* extra coordinates of P are overwritten.                                   */
+/*****************************************************************************/
+
+static int mon_ted_affine(Word *r, PROPOINT *q, const ECDPARAM *m)
+{
+  int err, len = m->len; Word c = m->c;
+  Word *prod = &(q->slack[len]);
+  (void) prod;  // to silence a warning
+  
+  // from twisted Edwards curve to Montgomery curve u = (Z+Y)/(Z-Y)
+  gfp_sub(q->extra, q->z, q->y, c, len);
+  gfp_add(q->slack, q->z, q->y, c, len);
+  
+#ifdef MSPECC_USE_CT_INV
+  // constant-time inversion of Z-Y (safegcd or Fermat)
+  err = gfp_inv_ct(q->extra, q->extra, c, len);
+  if (err != MSPECC_NO_ERROR) return err;
+#else
+  // "masked" inversion of Z-Y to thwart timing attacks
+  gfp_mul(q->x, q->extra, SECC_INV_MASK, c, len);
+  err = gfp_inv(q->x, q->x, c, len);
+  if (err != MSPECC_NO_ERROR) return err;
+  gfp_mul(q->extra, q->x, SECC_INV_MASK, c, len);
+#endif
+  
+  // get least non-negative residue of u = (Z+Y)/(Z-Y)
+  gfp_mul(q->x, q->slack, q->extra, c, len);
+  gfp_lnr(r, q->x, c, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
 int mon_mul_fixbase(Word *r, const Word *k, const ECDPARAM *m)
 {
-  int err, len = m->len, c = m->c;
+  int len = m->len;
   Word tmp[8*_len];
   PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
-  Word *prod = &(q.slack[len]);
-  (void) prod;  // to silence a warning
   
-  // set r to 0 when k is 0 (should normally never happen)
-  if (int_is0(k, len)) { int_set(r, 0, len); return MSPECC_ERR_INVALID_SCALAR; }
+  // set r to 0 when k is 0 or k >= 2^(w*len-1), which the signed comb does
+  // not support (should normally never happen since scalars are "clamped")
+  if (int_is0(k, len) | (k[len-1] >> (WSIZE-1))) {
+    int_set(r, 0, len);
+    return MSPECC_ERR_INVALID_SCALAR;
+  }
   
   // perform scalar multiplication via fixed-base comb method
-  ted_mul_comb4b(&q, k, m);
+  ted_mul_comb(&q, k, m);
   
-  // from twisted Edwards curve to Montgomery curve u = (Z+Y)/(Z-Y)
-  gfp_sub(q.extra, q.z, q.y, c, len);
-  gfp_add(q.slack, q.z, q.y, c, len);
+  return mon_ted_affine(r, &q, m);
+}
+
+
+/*****************************************************************************/
+/* Batched variants of mon_mul_varbase and mon_mul_fixbase, which compute    */
+/* num scalar multiplications and convert their results to affine           */
+/* coordinates with a single inversion (Montgomery's trick, gfp_inv_batch)   */
+/* per chunk of up to MSPECC_MAX_BATCH results. Scalars, base points and     */
+/* results are stored consecutively, i.e. the i-th one starts at index       */
+/* i*len. The return value is the bitwise OR of the error codes of all       */
+/* scalar multiplications; results causing an error are set to 0.            */
+/*****************************************************************************/
+
+int mon_mul_varbase_batch(Word *r, const Word *k, const Word *xp, int num,
+                          const ECDPARAM *m)
+{
+  int i, j, n, err = MSPECC_NO_ERROR, len = m->len; Word c = m->c;
+  Word tmp[6*_len]; // temporary space for six gfp elements
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, &tmp[3*len] };
+  Word z[MSPECC_MAX_BATCH*_len], zinv[MSPECC_MAX_BATCH*_len];
+  int ierr[MSPECC_MAX_BATCH];
+  
+  for (j = 0; j < num; j += n) {
+    n = ((num - j) < MSPECC_MAX_BATCH) ? (num - j) : MSPECC_MAX_BATCH;
+    
+    // Montgomery ladder, projective X is stored in r, Z in z
+    for (i = 0; i < n; i++) {
+      ierr[i] = MSPECC_NO_ERROR;
+      int_set(&z[i*len], 1, len);
+      if (int_is0(&k[(j+i)*len], len) | (k[(j+i)*len+len-1] >> (WSIZE-1))) {
+        ierr[i] = MSPECC_ERR_INVALID_SCALAR;
+        continue;
+      }
+      mon_mul_ladder_consttime(&q, &k[(j+i)*len], &xp[(j+i)*len], m);
+      int_copy(&r[(j+i)*len], q.x, len);
+      gfp_lnr(&z[i*len], q.z, c, len);
+      // a Z of 0 would turn the product of all Z coordinates into 0
+      if (int_is0(&z[i*len], len)) {
+        ierr[i] = MSPECC_ERR_INVERSION_ZERO;
+        int_set(&z[i*len], 1, len);
+      }
+    }
+    
+    // get least non-negative residue of x = X*(1/Z)
+    gfp_inv_batch(zinv, z, n, c, len);
+    for (i = 0; i < n; i++) {
+      if (ierr[i] != MSPECC_NO_ERROR) {
+        int_set(&r[(j+i)*len], 0, len);
+        err |= ierr[i];
+        continue;
+      }
+      gfp_mul(q.x, &r[(j+i)*len], &zinv[i*len], c, len);
+      gfp_lnr(&r[(j+i)*len], q.x, c, len);
+    }
+  }
   
-  // "masked" inversion of Z-Y to thwart timing attacks
-  gfp_mul(q.x, q.extra, SECC_INV_MASK, c, len);
-  err = gfp_inv(q.x, q.x, c, len);
-  if (err != MSPECC_NO_ERROR) return err;
-  gfp_mul(q.extra, q.x, SECC_INV_MASK, c, len);
+  return err;
+}
+
+
+int mon_mul_fixbase_batch(Word *r, const Word *k, int num, const ECDPARAM *m)
+{
+  int i, j, n, err = MSPECC_NO_ERROR, len = m->len; Word c = m->c;
+  Word tmp[8*_len];
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  Word z[MSPECC_MAX_BATCH*_len], zinv[MSPECC_MAX_BATCH*_len];
+  int ierr[MSPECC_MAX_BATCH];
+  
+  for (j = 0; j < num; j += n) {
+    n = ((num - j) < MSPECC_MAX_BATCH) ? (num - j) : MSPECC_MAX_BATCH;
+    
+    // fixed-base comb method, Z+Y is stored in r, Z-Y in z
+    for (i = 0; i < n; i++) {
+      ierr[i] = MSPECC_NO_ERROR;
+      int_set(&z[i*len], 1, len);
+      if (int_is0(&k[(j+i)*len], len) | (k[(j+i)*len+len-1] >> (WSIZE-1))) {
+        ierr[i] = MSPECC_ERR_INVALID_SCALAR;
+        continue;
+      }
+      ted_mul_comb(&q, &k[(j+i)*len], m);
+      gfp_add(&r[(j+i)*len], q.z, q.y, c, len);
+      gfp_sub(q.extra, q.z, q.y, c, len);
+      gfp_lnr(&z[i*len], q.extra, c, len);
+      if (int_is0(&z[i*len], len)) {
+        ierr[i] = MSPECC_ERR_INVERSION_ZERO;
+        int_set(&z[i*len], 1, len);
+      }
+    }
+    
+    // get least non-negative residue of u = (Z+Y)/(Z-Y)
+    gfp_inv_batch(zinv, z, n, c, len);
+    for (i = 0; i < n; i++) {
+      if (ierr[i] != MSPECC_NO_ERROR) {
+        int_set(&r[(j+i)*len], 0, len);
+        err |= ierr[i];
+        continue;
+      }
+      gfp_mul(q.x, &r[(j+i)*len], &zinv[i*len], c, len);
+      gfp_lnr(&r[(j+i)*len], q.x, c, len);
+    }
+  }
   
-  // get least non-negative residue of u = (Z+Y)/(Z-Y)
-  gfp_mul(q.x, q.slack, q.extra, c, len);
-  gfp_lnr(r, q.x, c, len);
+  return err;
+}
+
+
+/*****************************************************************************/
+/* Elligator 2 for Montgomery curves v^2 = u^3 + A*u^2 + u over a prime      */
+/* field with p = 5 mod 8, in which 2 is a non-square ("Elligator: Elliptic- */
+/* curve points indistinguishable from uniform random strings", CCS 2013). A */
+/* representative r is mapped to u = w if w^3 + A*w^2 + w is a square, and   */
+/* to u = -w-A otherwise, whereby w = -A/(1+2*r^2). Conversely, a point with */
+/* u != -A has a representative iff -2*u*(u+A) is a square, namely r =       */
+/* sqrt(-u/(2*(u+A))), which holds for about half of all points. The root r  */
+/* is chosen from [0, (p-1)/2], i.e. it has (at least) two leading 0 bits,   */
+/* which can be randomized and are ignored by the decoding.                  */
+/*****************************************************************************/
+
+// constant A = 4*(A+2)/4 - 2 of the Montgomery curve, whereby (A+2)/4 is a
+// 32-bit constant (see gfp_mul32)
+static void mon_elligator_a(Word *a, const ECDPARAM *m)
+{
+  int len = m->len; Word c = m->c;
+  Word t[_len];
+  
+  int_set(t, 0, len);
+  int_copy(t, m->a24, (WSIZE == 16) ? 2 : 1);
+  gfp_add(a, t, t, c, len);
+  gfp_add(a, a, a, c, len);
+  int_set(t, 2, len);
+  gfp_sub(a, a, t, c, len);
+}
+
+
+// representative r of u = n/d (not constant-time), which is computed from the
+// projective fraction with one exponentiation and no inversion
+static int mon_elligator_root(Word *r, const Word *n, const Word *d,
+                              const ECDPARAM *m)
+{
+  int len = m->len; Word c = m->c;
+  Word tmp[3*_len];  // temporary space for three gfp elements
+  Word *a = tmp, *s = &tmp[len], *t = &tmp[2*len];
+  
+  if ((c & 7) != 3) return MSPECC_ERR_INVALID_POINT;
+  
+  // r = sqrt(-n/(2*(n + A*d))), whereby u = 0 has no representative
+  mon_elligator_a(a, m);
+  gfp_mul(s, a, d, c, len);
+  gfp_add(s, s, n, c, len);
+  gfp_add(t, s, s, c, len);             // t = 2*(n + A*d)
+  gfp_lnr(s, n, c, len);
+  if (int_is0(s, len)) return MSPECC_ERR_INVALID_POINT;
+  gfp_cneg(s, s, c, 1, len);            // s = -n
+  if (!gfp_sqrt_ratio(r, s, t, m->rm1, c, len))
+    return MSPECC_ERR_INVALID_POINT;
+  
+  // select the root in [0, (p-1)/2]
+  gfp_lnr(r, r, c, len);
+  gfp_cneg(t, r, c, 1, len);
+  gfp_lnr(t, t, c, len);
+  if (int_cmp(r, t, len) > 0) int_copy(r, t, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
+int mon_elligator_encode(Word *r, const Word *u, const ECDPARAM *m)
+{
+  int err, len = m->len;
+  Word d[_len];
+  
+  int_set(d, 1, len);
+  err = mon_elligator_root(r, u, d, m);
+  if (err != MSPECC_NO_ERROR) int_set(r, 0, len);
+  
+  return err;
+}
+
+
+int mon_elligator_decode(Word *u, const Word *r, const ECDPARAM *m)
+{
+  int err, len = m->len; Word c = m->c;
+  Word tmp[4*_len];  // temporary space for four gfp elements
+  Word *a = tmp, *w = &tmp[len], *s = &tmp[2*len], *t = &tmp[3*len];
+  
+  if ((c & 7) != 3) {
+    int_set(u, 0, len);
+    return MSPECC_ERR_INVALID_POINT;
+  }
+  
+  // w = -A/(1 + 2*r^2), the denominator can not be 0 since -1/2 is not a
+  // square (the representative is public, i.e. gfp_inv can be used)
+  mon_elligator_a(a, m);
+  int_copy(t, r, len);
+  t[len-1] &= (((Word) -1L) >> 2);
+  gfp_sqr(s, t, c, len);
+  gfp_add(s, s, s, c, len);
+  int_set(t, 1, len);
+  gfp_add(s, s, t, c, len);
+  err = gfp_inv(s, s, c, len);
+  if (err != MSPECC_NO_ERROR) { int_set(u, 0, len); return err; }
+  gfp_mul(t, a, s, c, len);
+  gfp_cneg(w, t, c, 1, len);
+  
+  // u = w if w^3 + A*w^2 + w = w*(w*(w + A) + 1) is a square, else -w - A
+  gfp_add(t, w, a, c, len);
+  gfp_mul(s, t, w, c, len);
+  int_set(t, 1, len);
+  gfp_add(s, s, t, c, len);
+  gfp_mul(t, s, w, c, len);
+  int_set(s, 1, len);
+  if (!gfp_sqrt_ratio(s, t, s, m->rm1, c, len)) {
+    gfp_add(t, w, a, c, len);
+    gfp_cneg(w, t, c, 1, len);
+  }
+  gfp_lnr(u, w, c, len);
   
   return MSPECC_NO_ERROR;
 }
 
 
+/*****************************************************************************/
+/* Generation of a key pair whose public key u has an Elligator 2            */
+/* representative r. Instead of a new scalar multiplication for each         */
+/* rejected candidate, the scalar k is incremented by 8 and the point P =    */
+/* k*G by 8*G (one addition), until u = (Z+Y)/(Z-Y) has a representative.    */
+/* The representability is tested on the projective fraction, so that only   */
+/* the accepted u is inverted. The scalar k must be "clamped" and is updated */
+/* in place; the three least significant bits remain 0 and the top bit is    */
+/* checked (which is set with negligible probability). For Curve25519, the   */
+/* point of order 8 multiplied by the three least significant bits of        */
+/* 'tweak' is added to P, so that u is not restricted to the prime-order     */
+/* subgroup (it vanishes in a DH with a clamped scalar). The bits 6 and 7 of */
+/* 'tweak' become the two most significant bits of r.                        */
+/*****************************************************************************/
+
+int mon_mul_fixbase_elligator(Word *u, Word *r, Word *k, int tweak,
+                              const ECDPARAM *m)
+{
+  int i, err, len = m->len; Word c = m->c, sum, carry;
+  Word tmp[17*_len];
+  PROPOINT p = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  PROPOINT h = { &tmp[8*len], &tmp[9*len], &tmp[10*len], &tmp[11*len],
+                 p.slack };
+  PROPOINT q = { &tmp[13*len], &tmp[14*len], &tmp[15*len], &tmp[16*len],
+                 p.slack };
+  
+  if (int_is0(k, len) | (k[len-1] >> (WSIZE-1)) | ((c & 7) != 3)) {
+    int_set(u, 0, len);
+    int_set(r, 0, len);
+    return MSPECC_ERR_INVALID_SCALAR;
+  }
+  
+  // P = k*G via fixed-base comb method plus a low-order point (Curve25519)
+  ted_mul_comb(&p, k, m);
+  if ((len*WSIZE == 256) && (c == 19)) {
+    int_copy(h.x, SECC_LOW_ORDER, 3*len);
+    for (i = 0; i < (tweak & 7); i++) ted_add(&p, &h, m);
+  }
+  
+  // Q = 8*G in cached coordinates (G is the entry 1 of the comb table)
+  ted_load_point(&q, 1, m);
+  ted_extaff_extpro(&h, &q, m);
+  ted_double(&h, m);
+  ted_double(&h, m);
+  ted_double(&h, m);
+  ted_extpro_cached(&q, &h, m);
+  
+  // try u = (Z+Y)/(Z-Y) of P, P + 8*G, P + 16*G, ... until r exists
+  while (1) {
+    gfp_add(h.x, p.z, p.y, c, len);
+    gfp_sub(h.y, p.z, p.y, c, len);
+    if (mon_elligator_root(r, h.x, h.y, m) == MSPECC_NO_ERROR) break;
+    for (i = 0, carry = 8; i < len; i++) {
+      sum = k[i] + carry;
+      carry = (sum < carry);
+      k[i] = sum;
+    }
+    if (k[len-1] >> (WSIZE-1)) {
+      int_set(u, 0, len);
+      int_set(r, 0, len);
+      return MSPECC_ERR_INVALID_SCALAR;
+    }
+    ted_add_ext(&p, &q, m);
+  }
+  r[len-1] |= ((Word) ((tweak >> 6) & 3)) << (WSIZE-2);
+  
+  err = mon_ted_affine(u, &p, m);
+  if (err != MSPECC_NO_ERROR) int_set(r, 0, len);
+  
+  return err;
+}
+
+
 /*****************************************************************************/
 /* Convert a point P on a Montgomery curve to the corresponding point R on   */
 /* the birationally equivalent twisted Edwards curve. The point P is         */
@@ -465,7 +833,7 @@ void mon_test25519(void)
   Word k[256/WSIZE] = {                                             \
     0x46A0, 0x6BE3, 0x52F0, 0x9D7C, 0x163B, 0x4B15, 0x4682, 0xDD5E, \
     0x1462, 0x0A4C, 0xFCC1, 0x185A, 0x6A50, 0x4422, 0x44BA, 0x449A };
-  #else  // WSIZE == 32
+  #elif (WSIZE == 32)
   // Word x[256/WSIZE] = {                             \
   //   0x00000009, 0x00000000, 0x00000000, 0x00000000, \
   //   0x00000000, 0x00000000, 0x00000000, 0x00000000 };
@@ -480,6 +848,14 @@ void mon_test25519(void)
   Word k[256/WSIZE] = {                             \
     0x6BE346A0, 0x9D7C52F0, 0x4B15163B, 0xDD5E4682, \
     0x0A4C1462, 0x185AFCC1, 0x44226A50, 0x449A44BA };
+  #else  // WSIZE == 64
+  // r = 0x4F2B886F147EFCAD4D67785BC843833F3735E4ECC2615BD3B4C17D7B7DDB9EDE
+  Word x[256/WSIZE] = {                     \
+    0xDB3030586768DBE6, 0x7C5FB124A4C19435, \
+    0x3B35B326EC246672, 0x4C1CABD0A603A910 };
+  Word k[256/WSIZE] = {                     \
+    0x9D7C52F06BE346A0, 0xDD5E46824B15163B, \
+    0x185AFCC10A4C1462, 0x449A44BA44226A50 };
   #endif
   
   Word r[256/WSIZE];
@@ -487,7 +863,7 @@ void mon_test25519(void)
   
   // pruning: make sure that scalar k is a valid scalar
   k[len-1] &= (((Word) -1L) >> 1);            // 0x7F..FF 
-  k[len-1] |= ((Word) (1UL << (WSIZE - 2)));  // 0x40..00 
+  k[len-1] |= (((Word) 1) << (WSIZE - 2));  // 0x40..00 
   k[0]     &= ((Word) -8L);                   // 0xFF..F8
   
   #ifdef MSPECC_DEBUG_PRINT
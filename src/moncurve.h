@@ -21,6 +21,17 @@
 
 #include "typedefs.h"
 
+/* number of scalar multiplications the multi-buffer ladder in monvec.c    */
+/* performs in lockstep, i.e. the number of 64-bit lanes of the widest      */
+/* vector unit with a 32x32-bit multiplication (AVX-512F: 8, AVX2: 4)       */
+#if defined(__AVX512F__)
+#define MON_PAR_LANES 8
+#elif defined(__AVX2__)
+#define MON_PAR_LANES 4
+#else
+#define MON_PAR_LANES 1
+#endif
+
 /***********************/
 /* function prototypes */
 /***********************/
@@ -29,11 +40,19 @@ void mon_add(PROPOINT *p, const PROPOINT *q, const Word *x, const ECDPARAM *m);
 void mon_double(PROPOINT *p, const ECDPARAM *m);
 int  mon_check_order(PROPOINT *r, const Word *xp, const ECDPARAM *m);
 void mon_mul_ladder(PROPOINT *r, const Word *k, const Word *x, const ECDPARAM *m);
+void mon_mul_ladder_consttime(PROPOINT *r, const Word *k, const Word *x, const ECDPARAM *m);
 void mon_to_ted(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
 int  mon_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
 void mon_recover_y(PROPOINT *r, const PROPOINT *q, const PROPOINT *p, const ECDPARAM *m);
 int  mon_mul_varbase(Word *r, const Word *k, const Word *p, const ECDPARAM *m);
 int mon_mul_fixbase(Word *r, const Word *k, const ECDPARAM *m);
+int  mon_mul_varbase_batch(Word *r, const Word *k, const Word *p, int num, const ECDPARAM *m);
+int  mon_mul_fixbase_batch(Word *r, const Word *k, int num, const ECDPARAM *m);
+int  mon_mul_varbase_x4(Word *r, const Word *k, const Word *p, const ECDPARAM *m);
+int  mon_mul_varbase_x8(Word *r, const Word *k, const Word *p, const ECDPARAM *m);
+int  mon_elligator_encode(Word *r, const Word *u, const ECDPARAM *m);
+int  mon_elligator_decode(Word *u, const Word *r, const ECDPARAM *m);
+int  mon_mul_fixbase_elligator(Word *u, Word *r, Word *k, int tweak, const ECDPARAM *m);
 
 void mon_test25519(void);
 
@@ -0,0 +1,398 @@
+///////////////////////////////////////////////////////////////////////////////
+// monvec.c: Multi-buffer Montgomery ladder for Curve25519 (AVX2/AVX-512).   //
+// This file is part of SECC430, a Scalable ECC implementation for MSP430.   //
+// Version 0.7.0 (2023-06-24), see <http://www.cryptolux.org/> for updates.  //
+// License: GPLv3 (see LICENSE file), other licenses available upon request. //
+// ------------------------------------------------------------------------- //
+// This program is free software: you can redistribute it and/or modify it   //
+// under the terms of the GNU General Public License as published by the     //
+// Free Software Foundation, either version 3 of the License, or (at your    //
+// option) any later version. This program is distributed in the hope that   //
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied     //
+// warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the  //
+// GNU General Public License for more details. You should have received a   //
+// copy of the GNU General Public License along with this program. If not,   //
+// see <http://www.gnu.org/licenses/>.                                       //
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "intarith.h"
+#include "gfparith.h"
+#include "moncurve.h"
+
+
+#ifdef MSPECC_USE_VLA  // use variable-length arrays for field elements
+#define _len len       // requires "Allow VLA" in C/C++ Compiler Options
+#else  // use maximum-length arrays
+#define _len (MSPECC_MAX_LEN/WSIZE)
+#endif
+
+
+#if (MON_PAR_LANES > 1)  // vectorized ladder
+
+#include <immintrin.h>
+
+// The SIMD ladder performs MON_PAR_LANES independent scalar multiplications
+// in lockstep, each in one 64-bit lane of a vector register. An element of
+// GF(2^255-19) is represented by ten vectors of limbs in radix 2^25.5 (i.e.
+// limb i has weight 2^ceil(25.5*i) and is 26 or 25 bits long), so that the
+// 32x32-bit multiplication of the vector units (vpmuludq) can be used. The
+// limbs are unsigned, subtraction adds 2*p first.
+
+#if (MON_PAR_LANES == 8)
+typedef uint64_t VecW __attribute__((vector_size(64)));
+#define VMUL(a, b) ((VecW) _mm512_mul_epu32((__m512i) (a), (__m512i) (b)))
+#else
+typedef uint64_t VecW __attribute__((vector_size(32)));
+#define VMUL(a, b) ((VecW) _mm256_mul_epu32((__m256i) (a), (__m256i) (b)))
+#endif
+
+#define M26 0x3FFFFFFULL  // 2^26 - 1
+#define M25 0x1FFFFFFULL  // 2^25 - 1
+
+// number of Words of a Curve25519 element
+#define FE_LEN (256/WSIZE)
+
+
+/*------Conversion of a 256-bit integer into the limbs of a lane------*/
+static void fev_from_words(VecW *h, const Word *a, int lane)
+{
+  static const int off[11] = { 0, 26, 51, 77, 102, 128, 153, 179, 204, 230, 255 };
+  uint64_t x[4] = { 0, 0, 0, 0 }, l;
+  int i, lo, hi;
+  
+  for (i = 0; i < FE_LEN; i++) {
+    x[(i*WSIZE)/64] |= ((uint64_t) a[i]) << ((i*WSIZE)%64);
+  }
+  for (i = 0; i < 10; i++) {
+    lo = off[i]; hi = off[i+1];
+    l = x[lo/64] >> (lo%64);
+    if ((lo%64) + (hi - lo) > 64) l |= x[lo/64+1] << (64 - lo%64);
+    h[i][lane] = l & ((1ULL << (hi - lo)) - 1);
+  }
+  h[0][lane] += 19*(x[3] >> 63);  // MSB has weight 2^255 = 19 mod p
+}
+
+
+/*------Conversion of the limbs of a lane into a 256-bit integer------*/
+static void fev_to_words(Word *r, const VecW *f, int lane)
+{
+  static const int off[10] = { 0, 26, 51, 77, 102, 128, 153, 179, 204, 230 };
+  uint64_t x[4] = { 0, 0, 0, 0 }, l, s;
+  int i;
+  
+  // limbs are carried, hence the sum is less than 2^256 (no overflow)
+  for (i = 0; i < 10; i++) {
+    l = f[i][lane];
+    s = x[off[i]/64];
+    x[off[i]/64] += l << (off[i]%64);
+    l = (off[i]%64) ? (l >> (64 - off[i]%64)) : 0;
+    l += (x[off[i]/64] < s);  // carry into the next 64-bit word
+    if (off[i]/64 < 3) x[off[i]/64+1] += l;
+  }
+  for (i = 0; i < FE_LEN; i++) {
+    r[i] = (Word) (x[(i*WSIZE)/64] >> ((i*WSIZE)%64));
+  }
+}
+
+
+/*------Carry propagation, limbs are 26 or 25 bits long afterwards------*/
+static inline void fev_carry(VecW *h)
+{
+  VecW c;
+  
+  c = h[0] >> 26; h[1] += c; h[0] &= M26;
+  c = h[4] >> 26; h[5] += c; h[4] &= M26;
+  c = h[1] >> 25; h[2] += c; h[1] &= M25;
+  c = h[5] >> 25; h[6] += c; h[5] &= M25;
+  c = h[2] >> 26; h[3] += c; h[2] &= M26;
+  c = h[6] >> 26; h[7] += c; h[6] &= M26;
+  c = h[3] >> 25; h[4] += c; h[3] &= M25;
+  c = h[7] >> 25; h[8] += c; h[7] &= M25;
+  c = h[4] >> 26; h[5] += c; h[4] &= M26;
+  c = h[8] >> 26; h[9] += c; h[8] &= M26;
+  c = h[9] >> 25; h[0] += 19*c; h[9] &= M25;
+  c = h[0] >> 26; h[1] += c; h[0] &= M26;
+}
+
+
+/*------Addition h = f + g------*/
+static inline void fev_add(VecW *h, const VecW *f, const VecW *g)
+{
+  int i;
+  
+  for (i = 0; i < 10; i++) h[i] = f[i] + g[i];
+}
+
+
+/*------Subtraction h = f + 2*p - g (g must be carried)------*/
+static inline void fev_sub(VecW *h, const VecW *f, const VecW *g)
+{
+  int i;
+  
+  h[0] = f[0] + 0x7FFFFDAULL - g[0];
+  for (i = 1; i < 10; i += 2) h[i] = f[i] + 0x3FFFFFEULL - g[i];
+  for (i = 2; i < 10; i += 2) h[i] = f[i] + 0x7FFFFFEULL - g[i];
+}
+
+
+/*------Multiplication h = f*g (limbs of f and g less than 3*2^26)------*/
+static void fev_mul(VecW *h, const VecW *f, const VecW *g)
+{
+  VecW f2[10], g19[10];
+  int i;
+  
+  for (i = 1; i < 10; i += 2) f2[i] = f[i] + f[i];
+  for (i = 1; i < 10; i++) g19[i] = 19*g[i];
+  
+  h[0] = VMUL(f[0], g[0]) + VMUL(f2[1], g19[9]) + VMUL(f[2], g19[8])
+       + VMUL(f2[3], g19[7]) + VMUL(f[4], g19[6]) + VMUL(f2[5], g19[5])
+       + VMUL(f[6], g19[4]) + VMUL(f2[7], g19[3]) + VMUL(f[8], g19[2])
+       + VMUL(f2[9], g19[1]);
+  h[1] = VMUL(f[0], g[1]) + VMUL(f[1], g[0]) + VMUL(f[2], g19[9])
+       + VMUL(f[3], g19[8]) + VMUL(f[4], g19[7]) + VMUL(f[5], g19[6])
+       + VMUL(f[6], g19[5]) + VMUL(f[7], g19[4]) + VMUL(f[8], g19[3])
+       + VMUL(f[9], g19[2]);
+  h[2] = VMUL(f[0], g[2]) + VMUL(f2[1], g[1]) + VMUL(f[2], g[0])
+       + VMUL(f2[3], g19[9]) + VMUL(f[4], g19[8]) + VMUL(f2[5], g19[7])
+       + VMUL(f[6], g19[6]) + VMUL(f2[7], g19[5]) + VMUL(f[8], g19[4])
+       + VMUL(f2[9], g19[3]);
+  h[3] = VMUL(f[0], g[3]) + VMUL(f[1], g[2]) + VMUL(f[2], g[1])
+       + VMUL(f[3], g[0]) + VMUL(f[4], g19[9]) + VMUL(f[5], g19[8])
+       + VMUL(f[6], g19[7]) + VMUL(f[7], g19[6]) + VMUL(f[8], g19[5])
+       + VMUL(f[9], g19[4]);
+  h[4] = VMUL(f[0], g[4]) + VMUL(f2[1], g[3]) + VMUL(f[2], g[2])
+       + VMUL(f2[3], g[1]) + VMUL(f[4], g[0]) + VMUL(f2[5], g19[9])
+       + VMUL(f[6], g19[8]) + VMUL(f2[7], g19[7]) + VMUL(f[8], g19[6])
+       + VMUL(f2[9], g19[5]);
+  h[5] = VMUL(f[0], g[5]) + VMUL(f[1], g[4]) + VMUL(f[2], g[3])
+       + VMUL(f[3], g[2]) + VMUL(f[4], g[1]) + VMUL(f[5], g[0])
+       + VMUL(f[6], g19[9]) + VMUL(f[7], g19[8]) + VMUL(f[8], g19[7])
+       + VMUL(f[9], g19[6]);
+  h[6] = VMUL(f[0], g[6]) + VMUL(f2[1], g[5]) + VMUL(f[2], g[4])
+       + VMUL(f2[3], g[3]) + VMUL(f[4], g[2]) + VMUL(f2[5], g[1])
+       + VMUL(f[6], g[0]) + VMUL(f2[7], g19[9]) + VMUL(f[8], g19[8])
+       + VMUL(f2[9], g19[7]);
+  h[7] = VMUL(f[0], g[7]) + VMUL(f[1], g[6]) + VMUL(f[2], g[5])
+       + VMUL(f[3], g[4]) + VMUL(f[4], g[3]) + VMUL(f[5], g[2])
+       + VMUL(f[6], g[1]) + VMUL(f[7], g[0]) + VMUL(f[8], g19[9])
+       + VMUL(f[9], g19[8]);
+  h[8] = VMUL(f[0], g[8]) + VMUL(f2[1], g[7]) + VMUL(f[2], g[6])
+       + VMUL(f2[3], g[5]) + VMUL(f[4], g[4]) + VMUL(f2[5], g[3])
+       + VMUL(f[6], g[2]) + VMUL(f2[7], g[1]) + VMUL(f[8], g[0])
+       + VMUL(f2[9], g19[9]);
+  h[9] = VMUL(f[0], g[9]) + VMUL(f[1], g[8]) + VMUL(f[2], g[7])
+       + VMUL(f[3], g[6]) + VMUL(f[4], g[5]) + VMUL(f[5], g[4])
+       + VMUL(f[6], g[3]) + VMUL(f[7], g[2]) + VMUL(f[8], g[1])
+       + VMUL(f[9], g[0]);
+  fev_carry(h);
+}
+
+
+/*------Squaring h = f^2 (limbs of f less than 3*2^26)------*/
+static void fev_sqr(VecW *h, const VecW *f)
+{
+  VecW f2[10], f19[10], f38[10];
+  int i;
+  
+  for (i = 0; i < 8; i++) f2[i] = f[i] + f[i];
+  f19[6] = 19*f[6]; f19[8] = 19*f[8];
+  f38[5] = 38*f[5]; f38[7] = 38*f[7]; f38[9] = 38*f[9];
+  
+  h[0] = VMUL(f[0], f[0]) + VMUL(f2[1], f38[9]) + VMUL(f2[2], f19[8])
+       + VMUL(f2[3], f38[7]) + VMUL(f2[4], f19[6]) + VMUL(f[5], f38[5]);
+  h[1] = VMUL(f2[0], f[1]) + VMUL(f[2], f38[9]) + VMUL(f2[3], f19[8])
+       + VMUL(f[4], f38[7]) + VMUL(f2[5], f19[6]);
+  h[2] = VMUL(f2[0], f[2]) + VMUL(f2[1], f[1]) + VMUL(f2[3], f38[9])
+       + VMUL(f2[4], f19[8]) + VMUL(f2[5], f38[7]) + VMUL(f[6], f19[6]);
+  h[3] = VMUL(f2[0], f[3]) + VMUL(f2[1], f[2]) + VMUL(f[4], f38[9])
+       + VMUL(f2[5], f19[8]) + VMUL(f[6], f38[7]);
+  h[4] = VMUL(f2[0], f[4]) + VMUL(f2[1], f2[3]) + VMUL(f[2], f[2])
+       + VMUL(f2[5], f38[9]) + VMUL(f2[6], f19[8]) + VMUL(f[7], f38[7]);
+  h[5] = VMUL(f2[0], f[5]) + VMUL(f2[1], f[4]) + VMUL(f2[2], f[3])
+       + VMUL(f[6], f38[9]) + VMUL(f2[7], f19[8]);
+  h[6] = VMUL(f2[0], f[6]) + VMUL(f2[1], f2[5]) + VMUL(f2[2], f[4])
+       + VMUL(f2[3], f[3]) + VMUL(f2[7], f38[9]) + VMUL(f[8], f19[8]);
+  h[7] = VMUL(f2[0], f[7]) + VMUL(f2[1], f[6]) + VMUL(f2[2], f[5])
+       + VMUL(f2[3], f[4]) + VMUL(f[8], f38[9]);
+  h[8] = VMUL(f2[0], f[8]) + VMUL(f2[1], f2[7]) + VMUL(f2[2], f[6])
+       + VMUL(f2[3], f2[5]) + VMUL(f[4], f[4]) + VMUL(f[9], f38[9]);
+  h[9] = VMUL(f2[0], f[9]) + VMUL(f2[1], f[8]) + VMUL(f2[2], f[7])
+       + VMUL(f2[3], f[6]) + VMUL(f2[4], f[5]);
+  fev_carry(h);
+}
+
+
+/*------Multiplication by a 32-bit integer h = f*a------*/
+static inline void fev_mul32(VecW *h, const VecW *f, VecW a)
+{
+  int i;
+  
+  for (i = 0; i < 10; i++) h[i] = VMUL(f[i], a);
+  fev_carry(h);
+}
+
+
+/*------Conditional swap of f and g in the lanes where mask is all-1------*/
+static inline void fev_cswap(VecW *f, VecW *g, VecW mask)
+{
+  VecW t;
+  int i;
+  
+  for (i = 0; i < 10; i++) {
+    t = (f[i] ^ g[i]) & mask;
+    f[i] ^= t;
+    g[i] ^= t;
+  }
+}
+
+
+/*------Montgomery ladder for MON_PAR_LANES scalars and base points------*/
+static void mon_ladder_vec(Word *xr, Word *zr, const Word *k, const Word *xp,
+                           uint32_t a24)
+{
+  VecW x1[10], x2[10], z2[10], x3[10], z3[10];
+  VecW t0[10], t1[10], t2[10], t3[10], t4[10];
+  VecW va24, kb, swap;
+  int i, l;
+  
+  for (l = 0; l < MON_PAR_LANES; l++) {
+    fev_from_words(x1, &xp[l*FE_LEN], l);
+    va24[l] = a24;
+    swap[l] = 0;
+  }
+  for (i = 0; i < 10; i++) {
+    x2[i] = z2[i] = z3[i] = swap;
+    x3[i] = x1[i];
+  }
+  x2[0] += 1; z3[0] += 1;
+  
+  // constant-time ladder over bits 254..0 of k (bit 255 must be 0, which
+  // mon_mul_varbase_xn checks), (X2,Z2) = k*P, (X3,Z3) = (k+1)*P
+  for (i = 254; i >= 0; i--) {
+    for (l = 0; l < MON_PAR_LANES; l++) {
+      kb[l] = 0 - (uint64_t) ((k[l*FE_LEN+i/WSIZE] >> (i%WSIZE)) & 1);
+    }
+    swap ^= kb;
+    fev_cswap(x2, x3, swap);
+    fev_cswap(z2, z3, swap);
+    swap = kb;
+    
+    fev_add(t0, x2, z2);          // A = X2+Z2
+    fev_sub(t1, x2, z2);          // B = X2-Z2
+    fev_add(t2, x3, z3);          // C = X3+Z3
+    fev_sub(t3, x3, z3);          // D = X3-Z3
+    fev_mul(t4, t3, t0);          // DA = D*A
+    fev_mul(t3, t2, t1);          // CB = C*B
+    fev_sqr(t2, t0);              // AA = A^2
+    fev_sqr(t0, t1);              // BB = B^2
+    fev_add(t1, t4, t3);
+    fev_sqr(x3, t1);              // X3 = (DA+CB)^2
+    fev_sub(t1, t4, t3);
+    fev_sqr(t3, t1);
+    fev_mul(z3, x1, t3);          // Z3 = X1*(DA-CB)^2
+    fev_mul(x2, t2, t0);          // X2 = AA*BB
+    fev_sub(t1, t2, t0);          // E = AA-BB
+    fev_mul32(t3, t1, va24);
+    fev_add(t3, t3, t0);
+    fev_mul(z2, t1, t3);          // Z2 = E*(BB+a24*E)
+  }
+  fev_cswap(x2, x3, swap);
+  fev_cswap(z2, z3, swap);
+  
+  for (l = 0; l < MON_PAR_LANES; l++) {
+    fev_to_words(&xr[l*FE_LEN], x2, l);
+    fev_to_words(&zr[l*FE_LEN], z2, l);
+  }
+}
+
+#endif  // MON_PAR_LANES > 1
+
+
+/*****************************************************************************/
+/* Multi-buffer variable-base scalar multiplication R_i = k_i*P_i on a       */
+/* Montgomery curve for 4 (mon_mul_varbase_x4) or 8 (mon_mul_varbase_x8)     */
+/* independent pairs of scalars and base points. Scalars, x-coordinates and  */
+/* results are stored consecutively like in mon_mul_varbase_batch. When the  */
+/* target has a vector unit (MON_PAR_LANES > 1) and the curve is defined     */
+/* over GF(2^255-19), the Montgomery ladders of MON_PAR_LANES scalar         */
+/* multiplications are executed in lockstep in the lanes of the vector       */
+/* registers and their results are converted to affine coordinates with a   */
+/* single inversion. Otherwise, the scalar multiplications are performed by  */
+/* mon_mul_varbase_batch. The return value is the bitwise OR of the error    */
+/* codes of all scalar multiplications; results causing an error are 0.      */
+/*****************************************************************************/
+
+static int mon_mul_varbase_xn(Word *r, const Word *k, const Word *xp, int num,
+                              const ECDPARAM *m)
+{
+#if (MON_PAR_LANES > 1)
+  int i, j, n, err = MSPECC_NO_ERROR, len = m->len; Word c = m->c;
+  Word kv[MON_PAR_LANES*FE_LEN], xv[MON_PAR_LANES*FE_LEN];
+  Word xr[MON_PAR_LANES*FE_LEN], zr[MON_PAR_LANES*FE_LEN];
+  Word zinv[MON_PAR_LANES*FE_LEN], t[FE_LEN];
+  int ierr[MON_PAR_LANES];
+  uint32_t a24 = 0;
+  
+  if ((c != 19) || (len*WSIZE != 256)) {
+    return mon_mul_varbase_batch(r, k, xp, num, m);
+  }
+  for (i = 0; i < (32 + WSIZE - 1)/WSIZE; i++) {
+    a24 |= (uint32_t) (((uint64_t) m->a24[i]) << (i*WSIZE));
+  }
+  
+  for (j = 0; j < num; j += n) {
+    n = ((num - j) < MON_PAR_LANES) ? (num - j) : MON_PAR_LANES;
+    
+    // unused lanes (only when num < MON_PAR_LANES) get a copy of lane 0
+    for (i = 0; i < MON_PAR_LANES; i++) {
+      int_copy(&kv[i*len], &k[(j+((i < n) ? i : 0))*len], len);
+      int_copy(&xv[i*len], &xp[(j+((i < n) ? i : 0))*len], len);
+    }
+    mon_ladder_vec(xr, zr, kv, xv, a24);
+    
+    // replace Z by 1 in case of an error so that the batch inversion works
+    for (i = 0; i < n; i++) {
+      ierr[i] = MSPECC_NO_ERROR;
+      gfp_lnr(&zr[i*len], &zr[i*len], c, len);
+      if (int_is0(&k[(j+i)*len], len) | (k[(j+i)*len+len-1] >> (WSIZE-1))) {
+        ierr[i] = MSPECC_ERR_INVALID_SCALAR;
+      }
+      else if (int_is0(&zr[i*len], len)) ierr[i] = MSPECC_ERR_INVERSION_ZERO;
+      if (ierr[i] != MSPECC_NO_ERROR) int_set(&zr[i*len], 1, len);
+    }
+    
+    // get least non-negative residue of x = X*(1/Z)
+    gfp_inv_batch(zinv, zr, n, c, len);
+    for (i = 0; i < n; i++) {
+      if (ierr[i] != MSPECC_NO_ERROR) {
+        int_set(&r[(j+i)*len], 0, len);
+        err |= ierr[i];
+        continue;
+      }
+      gfp_mul(t, &xr[i*len], &zinv[i*len], c, len);
+      gfp_lnr(&r[(j+i)*len], t, c, len);
+    }
+  }
+  
+  return err;
+#else
+  return mon_mul_varbase_batch(r, k, xp, num, m);
+#endif
+}
+
+
+int mon_mul_varbase_x4(Word *r, const Word *k, const Word *xp,
+                       const ECDPARAM *m)
+{
+  return mon_mul_varbase_xn(r, k, xp, 4, m);
+}
+
+
+int mon_mul_varbase_x8(Word *r, const Word *k, const Word *xp,
+                       const ECDPARAM *m)
+{
+  return mon_mul_varbase_xn(r, k, xp, 8, m);
+}
@@ -70,9 +70,11 @@
 #if (__CODE_MODEL__ == __CODE_MODEL_SMALL__)
 #define OFFSET(n) (BYTES_PER_PUSH*(n) + 2)
 #define RET_ RET
+#define CALL_ CALL
 #else  // Code Model is Large
 #define OFFSET(n) (BYTES_PER_PUSH*(n) + 4)
 #define RET_ RETA
+#define CALL_ CALLA
 #endif
 #else  // __CODE_MODEL__ not defined
 #error __CODE_MODEL__ not defined (IAR Assembler version >= 6.40.1 required!)
@@ -154,6 +156,8 @@ EINT_ MACRO
 
 #define RET_ RET
 
+#define CALL_ CALL
+
 PUSH_R11 MACRO
     PUSH R11
     ENDM
@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "intarith.h"
+#include "sclarith.h"
+
+
+#ifdef MSPECC_USE_VLA  // use variable-length arrays for field elements
+#define _len len       // requires "Allow VLA" in C/C++ Compiler Options
+#else  // use maximum-length arrays
+#define _len (MSPECC_MAX_LEN/WSIZE)
+#endif
+
+
+/*------Barrett reduction r = a mod ord of a 2*len-Word integer a------*/
+// The quotient is estimated as q = floor(floor(a/b^(len-1))*mu/b^(len+1))
+// with b = 2^w and mu = floor(b^(2*len)/ord) (Handbook of Applied
+// Cryptography, Algorithm 14.42), whereby a - q*ord is computed modulo
+// b^(len+1) and is smaller than 3*ord. The two final subtractions of ord are
+// performed with masks, i.e. the execution time does not depend on a.
+void scl_red(Word *r, const Word *a, const ECDPARAM *m)
+{
+  int i, j, len = m->len, k = m->len + 1;
+  Word q[2*(_len+1)], t[2*(_len+1)], o[_len+1], mask;
+
+  int_mul(q, &a[len-1], m->omu, k);   // q = floor(a/b^(len-1))*mu
+  int_copy(o, m->ord, len);
+  o[len] = 0;
+  int_mul(t, &q[k], o, k);            // t = floor(q/b^(len+1))*ord
+  int_sub(t, a, t, k);                // t = (a - t) mod b^(len+1)
+
+  for (i = 0; i < 2; i++) {
+    // mask is all-1 if t >= ord, i.e. if there is no borrow
+    mask = ((Word) int_sub(q, t, o, k)) - 1;
+    for (j = 0; j < k; j++) t[j] ^= (t[j] ^ q[j]) & mask;
+  }
+  int_copy(r, t, len);
+}
+
+
+/*------Modular multiplication r = a*b mod ord------*/
+void scl_mul(Word *r, const Word *a, const Word *b, const ECDPARAM *m)
+{
+  int len = m->len;
+  Word t[2*_len];
+
+  int_mul(t, a, b, len);
+  scl_red(r, t, m);
+}
+
+
+/*------Modular multiply-add r = a*b + c mod ord (a*b + c < b^(2*len))------*/
+void scl_muladd(Word *r, const Word *a, const Word *b, const Word *c,
+                const ECDPARAM *m)
+{
+  int i, len = m->len;
+  Word t[2*_len], carry;
+
+  int_mul(t, a, b, len);
+  carry = (Word) int_add(t, t, c, len);
+  for (i = len; i < 2*len; i++) {
+    t[i] += carry;
+    carry &= (t[i] == 0);
+  }
+  scl_red(r, t, m);
+}
+
+
+/*------Check whether a scalar is reduced, i.e. a < ord------*/
+int scl_isred(const Word *a, const ECDPARAM *m)
+{
+  return (int_cmp(a, m->ord, m->len) < 0);
+}
@@ -0,0 +1,14 @@
+#ifndef _SCLARITH_H
+#define _SCLARITH_H
+
+#include "config.h"
+#include "typedefs.h"
+
+/* prototypes of functions for the arithmetic modulo the order 'ord' of the */
+/* base point (scalars of signature schemes), only C implementations exist  */
+void scl_red(Word *r, const Word *a, const ECDPARAM *m);
+void scl_mul(Word *r, const Word *a, const Word *b, const ECDPARAM *m);
+void scl_muladd(Word *r, const Word *a, const Word *b, const Word *c, const ECDPARAM *m);
+int  scl_isred(const Word *a, const ECDPARAM *m);
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ * @file sha512.c
+ * @brief Portable C99 implementation of SHA-512.
+ *
+ * Message words are loaded in big-endian byte order, hence the result is the
+ * same on hosts of any endianness. The 80 words of the message schedule are
+ * computed on the fly in a circular buffer of 16 words.
+ */
+
+#include <string.h>
+#include "sha512.h"
+
+
+// rotation of a 64-bit word to the right
+#define ROTR64(x, n) ((uint64_t) (((x) >> (n)) | ((x) << (64 - (n)))))
+
+// the functions Ch, Maj, Sigma0, Sigma1, sigma0, and sigma1 of FIPS 180-4
+#define CH(x, y, z)  (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define BSIG0(x) (ROTR64(x, 28) ^ ROTR64(x, 34) ^ ROTR64(x, 39))
+#define BSIG1(x) (ROTR64(x, 14) ^ ROTR64(x, 18) ^ ROTR64(x, 41))
+#define SSIG0(x) (ROTR64(x, 1) ^ ROTR64(x, 8) ^ ((x) >> 7))
+#define SSIG1(x) (ROTR64(x, 19) ^ ROTR64(x, 61) ^ ((x) >> 6))
+
+
+// round constants (first 64 bits of the fractional parts of the cube roots
+// of the first 80 primes)
+static const uint64_t SHA512_K[80] = {
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+  0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+  0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+  0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+  0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+  0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+  0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+  0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+  0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+  0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+  0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+  0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+  0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+  0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+  0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+  0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+  0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+  0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+  0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+  0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+  0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL };
+
+// initial chaining value
+static const uint64_t SHA512_IV[8] = {
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+  0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+  0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL };
+
+
+/*------Load a 64-bit word in big-endian byte order------*/
+static inline uint64_t load64be(const uint8_t *p)
+{
+  uint64_t x = 0;
+  int i;
+
+  for (i = 0; i < 8; i++) x = (x << 8) | p[i];
+  return x;
+}
+
+
+/*------Store a 64-bit word in big-endian byte order------*/
+static inline void store64be(uint8_t *p, uint64_t x)
+{
+  int i;
+
+  for (i = 7; i >= 0; i--) {
+    p[i] = (uint8_t) x;
+    x >>= 8;
+  }
+}
+
+
+/*------Compression function applied to one 128-byte block------*/
+static void sha512_block(uint64_t *h, const uint8_t *block)
+{
+  uint64_t w[16], s[8], t1, t2;
+  int i;
+
+  for (i = 0; i < 16; i++) w[i] = load64be(block + 8*i);
+  for (i = 0; i < 8; i++) s[i] = h[i];
+
+  for (i = 0; i < 80; i++) {
+    if (i >= 16) {
+      w[i & 15] += SSIG1(w[(i - 2) & 15]) + w[(i - 7) & 15] +
+                   SSIG0(w[(i - 15) & 15]);
+    }
+    t1 = s[7] + BSIG1(s[4]) + CH(s[4], s[5], s[6]) + SHA512_K[i] + w[i & 15];
+    t2 = BSIG0(s[0]) + MAJ(s[0], s[1], s[2]);
+    s[7] = s[6]; s[6] = s[5]; s[5] = s[4]; s[4] = s[3] + t1;
+    s[3] = s[2]; s[2] = s[1]; s[1] = s[0]; s[0] = t1 + t2;
+  }
+
+  for (i = 0; i < 8; i++) h[i] += s[i];
+}
+
+
+/*------Initialize a SHA-512 context------*/
+void sha512_init(sha512_s *ctx)
+{
+  memcpy(ctx->h, SHA512_IV, sizeof(ctx->h));
+  ctx->len = 0;
+}
+
+
+/*------Absorb 'len' bytes of 'data'------*/
+void sha512_update(sha512_s *ctx, const uint8_t *data, size_t len)
+{
+  size_t fill = (size_t) (ctx->len % SHA512_BLOCK_BYTES), n;
+
+  if (len == 0) return;
+  ctx->len += len;
+  if (fill > 0) {
+    n = SHA512_BLOCK_BYTES - fill;
+    if (n > len) n = len;
+    memcpy(ctx->buf + fill, data, n);
+    data += n;
+    len -= n;
+    if (fill + n < SHA512_BLOCK_BYTES) return;
+    sha512_block(ctx->h, ctx->buf);
+  }
+  while (len >= SHA512_BLOCK_BYTES) {
+    sha512_block(ctx->h, data);
+    data += SHA512_BLOCK_BYTES;
+    len -= SHA512_BLOCK_BYTES;
+  }
+  memcpy(ctx->buf, data, len);
+}
+
+
+/*------Pad the message and write the 64-byte digest------*/
+void sha512_final(sha512_s *ctx, uint8_t *digest)
+{
+  size_t fill = (size_t) (ctx->len % SHA512_BLOCK_BYTES);
+  int i;
+
+  // append the bit 1, zeros, and the 128-bit length in bits (the upper 64
+  // bits of which are always 0 here)
+  ctx->buf[fill++] = 0x80;
+  if (fill > SHA512_BLOCK_BYTES - 16) {
+    memset(ctx->buf + fill, 0, SHA512_BLOCK_BYTES - fill);
+    sha512_block(ctx->h, ctx->buf);
+    fill = 0;
+  }
+  memset(ctx->buf + fill, 0, SHA512_BLOCK_BYTES - 8 - fill);
+  store64be(ctx->buf + SHA512_BLOCK_BYTES - 8, ctx->len << 3);
+  sha512_block(ctx->h, ctx->buf);
+
+  for (i = 0; i < 8; i++) store64be(digest + 8*i, ctx->h[i]);
+}
+
+
+/*------Hash 'len' bytes of 'data' in one call------*/
+void sha512(uint8_t *digest, const uint8_t *data, size_t len)
+{
+  sha512_s ctx;
+
+  sha512_init(&ctx);
+  sha512_update(&ctx, data, len);
+  sha512_final(&ctx, digest);
+}
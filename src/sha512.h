@@ -0,0 +1,31 @@
+/**
+ * @file sha512.h
+ * @brief SHA-512 hash function (FIPS 180-4) as required by Ed25519.
+ *
+ * The hash is computed incrementally with sha512_init, sha512_update and
+ * sha512_final, or in one call with sha512. The implementation is portable
+ * C99; the message schedule is kept in a 16-word circular buffer so that the
+ * state fits into about 200 bytes of RAM on the MSP430.
+ */
+#ifndef _SHA512_H
+#define _SHA512_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* number of bytes of a SHA-512 digest and of a message block */
+#define SHA512_DIGEST_BYTES 64
+#define SHA512_BLOCK_BYTES 128
+
+typedef struct sha512_s_ {
+  uint64_t h[8];                    // chaining value
+  uint8_t buf[SHA512_BLOCK_BYTES];  // partial message block
+  uint64_t len;                     // number of bytes hashed so far
+} sha512_s;
+
+void sha512_init(sha512_s *ctx);
+void sha512_update(sha512_s *ctx, const uint8_t *data, size_t len);
+void sha512_final(sha512_s *ctx, uint8_t *digest);
+void sha512(uint8_t *digest, const uint8_t *data, size_t len);
+
+#endif  // _SHA512_H
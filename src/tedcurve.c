@@ -24,6 +24,32 @@
 #include "ecdparam.h"
 #include "moncurve.h"
 #include "tedcurve.h"
+#if (MSPECC_MSM_THREADS > 1)
+#include <pthread.h>
+#endif
+
+// vector operations for the constant-time table lookup on x86 hosts
+#if defined(MSPECC_USE_CT_COMB) && defined(__AVX2__)
+#include <immintrin.h>
+#define CT_VEC         __m256i
+#define CT_ZERO        _mm256_setzero_si256()
+#define CT_SET1(x)     _mm256_set1_epi32(x)
+#define CT_CMPEQ(x, y) _mm256_cmpeq_epi32((x), (y))
+#define CT_AND(x, y)   _mm256_and_si256((x), (y))
+#define CT_OR(x, y)    _mm256_or_si256((x), (y))
+#define CT_LOAD(p)     _mm256_loadu_si256((const __m256i *) (p))
+#define CT_STORE(p, x) _mm256_storeu_si256((__m256i *) (p), (x))
+#elif defined(MSPECC_USE_CT_COMB) && defined(__SSE2__)
+#include <emmintrin.h>
+#define CT_VEC         __m128i
+#define CT_ZERO        _mm_setzero_si128()
+#define CT_SET1(x)     _mm_set1_epi32(x)
+#define CT_CMPEQ(x, y) _mm_cmpeq_epi32((x), (y))
+#define CT_AND(x, y)   _mm_and_si128((x), (y))
+#define CT_OR(x, y)    _mm_or_si128((x), (y))
+#define CT_LOAD(p)     _mm_loadu_si128((const __m128i *) (p))
+#define CT_STORE(p, x) _mm_storeu_si128((__m128i *) (p), (x))
+#endif
 
 
 #ifdef MSPECC_USE_VLA  // use variable-length arrays for field elements
@@ -35,11 +61,14 @@
 
 #if (WSIZE == 16)
 #define GET_BIT(k, i) ((k[((i)>>4)] >> ((i) & 0x0F)) & 1)
-#else  // 32 bits
+#elif (WSIZE == 32)
 #define GET_BIT(k, i) ((k[((i)>>5)] >> ((i) & 0x1F)) & 1)
+#else  // 64 bits
+#define GET_BIT(k, i) ((k[((i)>>6)] >> ((i) & 0x3F)) & 1)
 #endif
 
 
+#ifndef MSPECC_USE_CT_INV  // mask for the inversion via gfp_inv
 #if (WSIZE == 16)
 static const Word SECC_INV_MASK[16] = {                           \
   0x5F58, 0xE072, 0x28DB, 0x1703, 0xBC96, 0x22E6, 0x97C4, 0xA158, \
@@ -47,14 +76,22 @@ static const Word SECC_INV_MASK[16] = {                           \
 #if ((MSPECC_MAX_LEN/WSIZE) > 16)
 #error "Multiplicative mask for secure inversion must be extended!"
 #endif // MSPECC_MAX_LEN/WSIZE) > 16)
-#else  // 32 bits
+#elif (WSIZE == 32)
 static const Word SECC_INV_MASK[8] = {            \
   0xE0725F58, 0x170328DB, 0x22E6BC96, 0xA15897C4, \
   0xCED0646A, 0xE6282D36, 0x49089A79, 0x76F94D46  };
 #if ((MSPECC_MAX_LEN/WSIZE) > 8)
 #error "Multiplicative mask for secure inversion must be extended!"
 #endif // MSPECC_MAX_LEN/WSIZE) > 8)
+#else  // 64 bits
+static const Word SECC_INV_MASK[4] = {      \
+  0x170328DBE0725F58, 0xA15897C422E6BC96, \
+  0xE6282D36CED0646A, 0x76F94D4649089A79  };
+#if ((MSPECC_MAX_LEN/WSIZE) > 4)
+#error "Multiplicative mask for secure inversion must be extended!"
+#endif // MSPECC_MAX_LEN/WSIZE) > 4)
 #endif
+#endif  // MSPECC_USE_CT_INV
 
 
 /*****************************************************************************/
@@ -219,6 +256,28 @@ void ted_add_pro(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
 }
 
 
+/*****************************************************************************/
+/* Point addition P = P + Q on a twisted Edwards curve where P is given in   */
+/* extended projective coordinates of the form (X,Y,Z,E,H) with E*H = T =    */
+/* X*Y/Z and Q in cached coordinates of the form (U,V,W,Z) with U/Z = u, V/Z */
+/* = v, and W/Z = w (see ted_extpro_cached). Since the formula of ted_add is */
+/* homogeneous in (u,v,w,1), Q can be added with ted_add after Z1 has been   */
+/* multiplied by the Z coordinate of Q, which is referenced by the element   */
+/* 'extra' of the PROPOINT structure.                                        */
+/*****************************************************************************/
+
+void ted_add_ext(PROPOINT *p, const PROPOINT *q, const ECDPARAM *m)
+{
+  int len = m->len; Word c = m->c;
+  Word *t1 = p->slack, *prod = &(p->slack[len]);
+  (void) prod;  // to silence a warning
+  
+  gfp_mul(t1, p->z, q->extra, c, len);  // t1 := z1*z2;
+  int_copy(p->z, t1, len);              // z1 := t1;
+  ted_add(p, q, m);
+}
+
+
 /*****************************************************************************/
 /* Conversion of a point P given in standard affine coordinates (x,y) into a */
 /* point R in extended affine coordinates of the form (u,v,w) where u =      */
@@ -268,6 +327,31 @@ void ted_extaff_extpro(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
 }
 
 
+/*****************************************************************************/
+/* Conversion of a point P given in extended projective coordinates of the   */
+/* form (X,Y,Z,E,H) with E*H = T = X*Y/Z into a point R in cached            */
+/* coordinates (U,V,W,Z') = (Y+X,Y-X,2*d*T,2*Z), i.e. the extended affine    */
+/* coordinates (u,v,w) scaled by 2*Z, which can be added via ted_add_ext.    */
+/* The coordinate Z' of R is referenced by the element 'extra'.              */
+/*****************************************************************************/
+
+void ted_extpro_cached(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
+{
+  int len = m->len; Word c = m->c;
+  Word *x = p->x, *y = p->y, *z = p->z;
+  Word *e = p->extra, *h = &(p->extra[len]);
+  Word *t1 = r->slack, *prod = &(r->slack[len]);
+  (void) prod;  // to silence a warning
+  
+  gfp_add(r->x, y, x, c, len);          // u := y+x;
+  gfp_sub(r->y, y, x, c, len);          // v := y-x;
+  gfp_mul(t1, e, h, c, len);            // t1 := e*h;
+  gfp_mul(r->z, t1, m->dte, c, len);    // w := d*t1;
+  gfp_add(r->z, r->z, r->z, c, len);    // w := 2*w;
+  gfp_add(r->extra, z, z, c, len);      // z := 2*z;
+}
+
+
 /*****************************************************************************/
 /* Conversion of a point P given in standard affine coordinates (x,y) into a */
 /* point R in (extended) projective coordinates of the form (X,Y,Z).         */
@@ -372,6 +456,10 @@ void ted_mul_binary(PROPOINT *r, const Word *k, const AFFPOINT *p,
 /* inversion is described in Section 6 of the paper "SPA Vulnerabilities of  */
 /* the Binary Extended Euclidean Algorithm" (Journal of Cryptographic        */
 /* Engineering, 2016).                                                       */
+/* When MSPECC_USE_CT_INV is defined, Z is instead inverted with a           */
+/* constant-time algorithm (gfp_inv_ct), i.e. either the safegcd algorithm   */
+/* of Bernstein and Yang (fixed number of divsteps) or exponentiation via    */
+/* Fermat's little theorem; neither of them needs a mask.                    */
 /*****************************************************************************/
 
 int ted_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
@@ -382,6 +470,15 @@ int ted_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
   Word *t1 = r->slack, *prod = &(r->slack[len]);
   (void) prod;  // to silence a warning
   
+#ifdef MSPECC_USE_CT_INV
+  // constant-time inversion of Z (safegcd or Fermat)
+  err = gfp_inv_ct(t1, zp, c, len);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_pro(r, len);
+    return err;
+  }
+  int_copy(zr, t1, len);
+#else
   // "masked" inversion of Z to thwart timing attacks
   gfp_mul(t1, zp, SECC_INV_MASK, c, len);
   err = gfp_inv(t1, t1, c, len);
@@ -390,6 +487,7 @@ int ted_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
     return err;
   }
   gfp_mul(zr, t1, SECC_INV_MASK, c, len);
+#endif
   
   // get least non-negative residue of x = X*(1/Z)
   gfp_mul(t1, xp, zr, c, len);
@@ -406,6 +504,84 @@ int ted_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m)
 }
 
 
+/*****************************************************************************/
+/* Compression of a point P given in standard affine coordinates (x,y) into  */
+/* len Words 'a': the y-coordinate (fully reduced) occupies the w*len-1      */
+/* least significant bits and the most significant bit holds the least       */
+/* significant bit of the (fully reduced) x-coordinate. For Curve25519, this */
+/* is the encoding of RFC 8032 when the Words are stored in little-endian    */
+/* order.                                                                    */
+/*****************************************************************************/
+
+void ted_compress(Word *a, const AFFPOINT *p, const ECDPARAM *m)
+{
+  int len = m->len; Word c = m->c;
+  Word t[_len];  // temporary space for one gfp element
+  
+  gfp_lnr(t, p->x, c, len);
+  gfp_lnr(a, p->y, c, len);
+  a[len-1] |= (t[0] & 1) << (WSIZE-1);
+}
+
+
+/*****************************************************************************/
+/* Decompression of len Words 'a' (see ted_compress) into a point R in       */
+/* standard affine coordinates (x,y). The x-coordinate is recovered from x^2 */
+/* = u/v with u = y^2-1 and v = d*y^2+1 by a single exponentiation that      */
+/* combines the inversion of v with the square root: for p = 5 mod 8, x =    */
+/* u*v^3*(u*v^7)^((p-5)/8) (see gfp_sqrt_ratio) satisfies v*x^2 = u or v*x^2 */
+/* = -u, in which case x is multiplied by the root of -1; for p = 3 mod 4, x */
+/* = u*v*(u*v^3)^((p-3)/4). The root with the least significant bit given by */
+/* the encoding is selected. The function returns MSPECC_ERR_INVALID_POINT   */
+/* if y is not smaller than p, u/v is not a square, or x = 0 with the sign   */
+/* bit set, whereby R is set to the neutral element. Since encodings are     */
+/* public, the decompression is not constant-time.                           */
+/*****************************************************************************/
+
+int ted_decompress(AFFPOINT *r, const Word *a, const ECDPARAM *m)
+{
+  int sign, len = m->len; Word c = m->c;
+  Word tmp[5*_len];  // temporary space for five gfp elements
+  Word *u = tmp, *v = &tmp[len], *t = &tmp[2*len], *s = &tmp[3*len];
+  Word *e = &tmp[4*len], *x = r->x, *y = r->y;
+  
+  sign = (int) (a[len-1] >> (WSIZE-1));
+  int_copy(y, a, len);
+  y[len-1] &= (((Word) -1L) >> 1);
+  gfp_lnr(t, y, c, len);
+  if (int_cmp(t, y, len) != 0) {
+    ted_set0_aff(r, len);
+    return MSPECC_ERR_INVALID_POINT;
+  }
+  
+  // u = y^2 - 1 and v = d*y^2 + 1
+  gfp_sqr(t, y, c, len);
+  int_set(e, 1, len);
+  gfp_sub(u, t, e, c, len);
+  gfp_mul(s, t, m->dte, c, len);
+  gfp_add(v, s, e, c, len);
+  
+  // x = sqrt(u/v) with a single exponentiation (see gfp_sqrt_ratio)
+  if (!gfp_sqrt_ratio(e, u, v, m->rm1, c, len)) {
+    ted_set0_aff(r, len);
+    return MSPECC_ERR_INVALID_POINT;
+  }
+  
+  // select the root with the least significant bit given by the encoding
+  gfp_lnr(x, e, c, len);
+  if (int_is0(x, len) && sign) {
+    ted_set0_aff(r, len);
+    return MSPECC_ERR_INVALID_POINT;
+  }
+  if ((int) (x[0] & 1) != sign) {
+    gfp_cneg(x, x, c, 1, len);
+    gfp_lnr(x, x, c, len);
+  }
+  
+  return MSPECC_NO_ERROR;
+}
+
+
 /*****************************************************************************/
 /* Variable-base scalar multiplication R = k*P on a twisted Edwards curve,   */
 /* including some tests to ensure the validity of inputs and outputs. The    */
@@ -475,17 +651,87 @@ int get_digit(const Word *k, int i, int len)
 }
 
 
+/*****************************************************************************/
+/* Load the entry with index 'i' from a table 'tbl' of 'num' points, each of */
+/* which consists of 3*len words (extended affine coordinates). When         */
+/* MSPECC_USE_CT_COMB is defined and 'ct' is non-zero, all entries are read  */
+/* and entry 'i' is selected with a mask so that the memory accesses (and    */
+/* the cache lines they touch) do not depend on the secret index 'i'. On x86 */
+/* hosts, the masked scan is performed with SSE2 or AVX2 instructions. For   */
+/* public indices ('ct' = 0), the entry is accessed directly.                */
+/*****************************************************************************/
+
+static void ted_load_entry(PROPOINT *r, const Word *tbl, int i, int num,
+                           int len, int ct)
+{
+#ifdef MSPECC_USE_CT_COMB
+  Word acc[3*_len], mask;
+  const Word *t;
+  int j, k, l = 0, n = 3*len;
+  
+#ifdef CT_VEC
+  // up to three vectors of each entry are combined in registers while all
+  // entries are scanned, the mask is obtained by a vector comparison
+  const int vw = sizeof(CT_VEC)/sizeof(Word);  // Words per vector
+  CT_VEC vi, vm, a0, a1, a2;
+  int cnt;
+#endif
+  
+  // a public index only needs its own entry to be "scanned"
+  if (!ct) {
+    tbl += 3*i*len;
+    i = 0;
+    num = 1;
+  }
+  
+#ifdef CT_VEC
+  vi = CT_SET1(i);
+  while (l + vw <= n) {
+    cnt = (n - l)/vw;
+    if (cnt > 3) cnt = 3;
+    a0 = a1 = a2 = CT_ZERO;
+    for (j = 0, t = tbl + l; j < num; j++, t += n) {
+      vm = CT_CMPEQ(CT_SET1(j), vi);
+      a0 = CT_OR(a0, CT_AND(vm, CT_LOAD(t)));
+      if (cnt > 1) a1 = CT_OR(a1, CT_AND(vm, CT_LOAD(t + vw)));
+      if (cnt > 2) a2 = CT_OR(a2, CT_AND(vm, CT_LOAD(t + 2*vw)));
+    }
+    CT_STORE(&acc[l], a0);
+    if (cnt > 1) CT_STORE(&acc[l+vw], a1);
+    if (cnt > 2) CT_STORE(&acc[l+2*vw], a2);
+    l += cnt*vw;
+  }
+#endif
+  
+  // remaining Words (all Words when there is no vector unit)
+  for (k = l; k < n; k++) acc[k] = 0;
+  for (j = 0, t = tbl; (j < num) && (l < n); j++, t += n) {
+    // mask is all-1 if j equals i and 0 otherwise
+    mask = ((Word) 0) - ((Word) ((((unsigned int) (j ^ i)) - 1) >>
+           (8*sizeof(unsigned int) - 1)));
+    for (k = l; k < n; k++) acc[k] |= t[k] & mask;
+  }
+  
+  int_copy(r->x, acc, len);
+  int_copy(r->y, &acc[len], len);
+  int_copy(r->z, &acc[2*len], len);
+#else
+  (void) num;  // to silence a warning
+  (void) ct;   // to silence a warning
+  int_copy(r->x, tbl + 3*i*len, len);
+  int_copy(r->y, tbl + (3*i + 1)*len, len);
+  int_copy(r->z, tbl + (3*i + 2)*len, len);
+#endif
+}
+
+
 /*****************************************************************************/
 /* Load the point with index 'i' from the pre-computed comb table.           */
 /*****************************************************************************/
 
 void ted_load_point(PROPOINT *r, int i, const ECDPARAM *m)
 {
-  int len = m->len;
-  
-  int_copy(r->x, m->tbl + 3*i*len, len);
-  int_copy(r->y, m->tbl + (3*i + 1)*len, len);
-  int_copy(r->z, m->tbl + (3*i + 2)*len, len);
+  ted_load_entry(r, m->tbl, i, 16, m->len, 1);
 }
 
 
@@ -520,6 +766,149 @@ void ted_mul_comb4b(PROPOINT *r, const Word *k, const ECDPARAM *m)
 }
 
 
+#ifdef MSPECC_COMB_TEETH
+
+/*****************************************************************************/
+/* Signed all-bit recoding of a scalar 'k' < 2^(w*len-1) for the comb method */
+/* with 'n' = teeth*cols bits. When k is even, the order l of the base point */
+/* is added (which does not change the result) so that k is odd; when the    */
+/* domain parameters have no order (ord = NULL), 1 is added instead and the  */
+/* function returns 1, i.e. the caller has to subtract the base point (see   */
+/* ted_comb_correct). The bits b_i of r = (k-1)/2 + 2^(n-1) (which is at     */
+/* most len+1 words long) give k as the sum of (2*b_i-1)*2^i for 0 <= i < n, */
+/* i.e. every bit of r stands for a digit of +1 or -1.                       */
+/*****************************************************************************/
+
+static int ted_comb_recode(Word *r, const Word *k, int n, const ECDPARAM *m)
+{
+  DWord sum = 0;
+  Word mask = ((Word) (k[0] & 1)) - 1;  // all-1 if k is even
+  int i, len = m->len;
+  
+  for (i = 0; i < len; i++) {
+    sum += (DWord) k[i] + ((m->ord != NULL) ? (m->ord[i] & mask) : 0);
+    r[i] = (Word) sum;
+    sum >>= WSIZE;
+  }
+  r[len] = (Word) sum;
+  if (m->ord == NULL) r[0] |= 1;
+  for (i = 0; i < len; i++) r[i] = (r[i+1] << (WSIZE - 1)) | (r[i] >> 1);
+  r[len] >>= 1;
+  r[(n-1)/WSIZE] |= ((Word) 1) << ((n-1) % WSIZE);
+  
+  return (m->ord == NULL) ? (int) (mask & 1) : 0;
+}
+
+
+/*****************************************************************************/
+/* Subtraction of the base point P from R when 'sub' is 1 (the recoding has  */
+/* added 1 to an even scalar). The point -P or, when 'sub' is 0, the neutral */
+/* element -P00 = P00 is loaded from the 16-point table (in constant time    */
+/* when 'ct' is non-zero) and added to R, so that the same operations are    */
+/* executed in both cases.                                                   */
+/*****************************************************************************/
+
+static void ted_comb_correct(PROPOINT *r, int sub, int ct, const ECDPARAM *m)
+{
+  int len = m->len;
+  Word tmp[3*_len]; // temporary space for three gfp elements
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, r->slack };
+  
+  ted_load_entry(&q, m->tbl, sub, 16, len, ct);
+  gfp_cswap(q.x, q.y, 1, len);
+  gfp_cneg(q.z, q.z, m->c, 1, len);
+  ted_add(r, &q, m);
+}
+
+
+/*****************************************************************************/
+/* Extract the column 'j' of a recoded scalar 'k' for the configurable comb, */
+/* i.e. the digit dj = sum of 2^t*k[t*cols+j] for 0 <= t < MSPECC_COMB_TEETH.*/
+/*****************************************************************************/
+
+static int get_comb_digit(const Word *k, int j, int cols)
+{
+  int t, d = 0;
+  
+  for (t = 0; t < MSPECC_COMB_TEETH; t++) d += (GET_BIT(k, t*cols + j) << t);
+  
+  return d;
+}
+
+
+/*****************************************************************************/
+/* Load the point of the configurable comb table for column 'j' (of 'cols')  */
+/* of a recoded scalar 'k' into Q in extended affine coordinates (u,v,w).    */
+/* Column j belongs to comb s = j/e. A column whose top digit is -1 is       */
+/* obtained by negating the entry with the complemented index, whereby the   */
+/* negation of (u,v,w) is (v,u,-w). The entry is loaded in constant time     */
+/* when 'ct' is non-zero (see ted_load_entry).                               */
+/*****************************************************************************/
+
+static void ted_load_column(PROPOINT *q, const Word *k, int j, int cols,
+                            int e, int ct, const ECDPARAM *m)
+{
+  int len = m->len, half = 1 << (MSPECC_COMB_TEETH - 1);
+  int di = get_comb_digit(k, j, cols);
+  int neg = 1 - (di >> (MSPECC_COMB_TEETH - 1));
+  
+  di = (di ^ (-neg)) & (half - 1);
+  ted_load_entry(q, m->ctb + 3*(j/e)*half*len, di, half, len, ct);
+  gfp_cswap(q->x, q->y, neg, len);
+  gfp_cneg(q->z, q->z, m->c, neg, len);
+}
+
+#endif
+
+
+/*****************************************************************************/
+/* Scalar multiplication R = k*P on a twisted Edwards curve according to the */
+/* fixed-base comb method of Lim and Lee with MSPECC_COMB_TEETH teeth and    */
+/* MSPECC_COMB_COMBS combs. The scalar 'k' (k < 2^(w*len-1)) is recoded into */
+/* signed digits (see ted_comb_recode) and viewed as a matrix with 'cols' =  */
+/* ceil(w*len/teeth) columns, which are split into 'combs' blocks of 'e' =   */
+/* ceil(cols/combs) columns each. Comb s of the table 'ctb' contains the     */
+/* 2^(teeth-1) points [2^((teeth-1)*cols) + sum of (2*v_t-1)*2^(t*cols)]*    */
+/* 2^(s*e)*P with 0 <= t < teeth-1 for v = 0...2^(teeth-1)-1; a column whose */
+/* top digit is -1 is obtained by negating the entry with the complemented   */
+/* index. Hence, e-1 doublings and up to combs*e additions are needed, and   */
+/* only half of a comb is scanned by the constant-time table lookup. When    */
+/* the domain parameters 'm' have no such table (or the comb is not          */
+/* configured), ted_mul_comb4b is used. The result R is given in extended    */
+/* projective coordinates of the form (X,Y,Z,E,H) with E*H = T = X*Y/Z.      */
+/*****************************************************************************/
+
+void ted_mul_comb(PROPOINT *r, const Word *k, const ECDPARAM *m)
+{
+#ifdef MSPECC_COMB_TEETH
+  int i, j, s, sub, len = m->len;
+  int cols = (WSIZE*len + MSPECC_COMB_TEETH - 1)/MSPECC_COMB_TEETH;
+  int e = (cols + MSPECC_COMB_COMBS - 1)/MSPECC_COMB_COMBS;
+  Word tmp[3*_len]; // temporary space for three gfp elements
+  Word kr[_len+1];  // recoded scalar
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, r->slack };
+  
+  if (m->ctb != NULL) {
+    sub = ted_comb_recode(kr, k, MSPECC_COMB_TEETH*cols, m);
+    for (i = e - 1; i >= 0; i--) {
+      if (i < e - 1) ted_double(r, m);
+      for (s = 0; s < MSPECC_COMB_COMBS; s++) {
+        j = s*e + i;
+        if (j >= cols) continue;
+        ted_load_column(&q, kr, j, cols, e, 1, m);
+        if ((i == e - 1) && (s == 0)) ted_extaff_extpro(r, &q, m);
+        else ted_add(r, &q, m);
+      }
+    }
+    if (m->ord == NULL) ted_comb_correct(r, sub, 1, m);
+    return;
+  }
+#endif
+  
+  ted_mul_comb4b(r, k, m);
+}
+
+
 /*****************************************************************************/
 /* Fixed-base scalar multiplication R = k*P on a twisted Edwards curve,      */
 /* including some tests to ensure the validity of inputs and outputs. The    */
@@ -534,8 +923,14 @@ int ted_mul_fixbase(AFFPOINT *r, const Word *k, const ECDPARAM *m)
   Word tmp[8*_len]; // temporary space for eight gfp elements
   PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
   
+  // the signed comb requires k < 2^(w*len-1)
+  if (k[len-1] >> (WSIZE-1)) {
+    ted_set0_aff(r, len);
+    return MSPECC_ERR_INVALID_SCALAR;
+  }
+  
   // perform scalar multiplication via fixed-base comb method
-  ted_mul_comb4b(&q, k, m);
+  ted_mul_comb(&q, k, m);
   
   // convert result from projective to affine coordinates
   err = ted_proj_affine(&q, &q, m);
@@ -559,6 +954,589 @@ int ted_mul_fixbase(AFFPOINT *r, const Word *k, const ECDPARAM *m)
 }
 
 
+/*****************************************************************************/
+/* Recoding of a scalar 'k' into a sliding-window NAF with digits 'naf[i]'   */
+/* that are either 0 or odd with |naf[i]| < 2^(MSPECC_WNAF_WIDTH-1), i.e.    */
+/* k = sum of naf[i]*2^i for 0 <= i <= w*len. Adjacent set bits are merged   */
+/* into a digit as long as it stays in range, otherwise the carry of a       */
+/* negative digit is propagated upwards (as in "slide" of the ref10 code of  */
+/* Ed25519). The return value is the position of the highest non-zero digit  */
+/* plus 1, which is 0 if k is 0. The recoding is not constant-time.          */
+/*****************************************************************************/
+
+static int ted_wnaf_recode(signed char *naf, const Word *k, int len)
+{
+  int i, b, l, n = WSIZE*len + 1;
+  int max = (1 << (MSPECC_WNAF_WIDTH - 1)) - 1;
+  
+  for (i = 0; i < n - 1; i++) naf[i] = (signed char) GET_BIT(k, i);
+  naf[n-1] = 0;
+  
+  for (i = 0; i < n; i++) {
+    if (naf[i] == 0) continue;
+    for (b = 1; (b < MSPECC_WNAF_WIDTH) && (i + b < n); b++) {
+      if (naf[i+b] == 0) continue;
+      if (naf[i] + (naf[i+b] << b) <= max) {
+        naf[i] += naf[i+b] << b;
+        naf[i+b] = 0;
+      } else if (naf[i] - (naf[i+b] << b) >= -max) {
+        naf[i] -= naf[i+b] << b;
+        for (l = i + b; l < n; l++) {
+          if (naf[l] == 0) { naf[l] = 1; break; }
+          naf[l] = 0;
+        }
+      } else break;
+    }
+  }
+  
+  while ((n > 0) && (naf[n-1] == 0)) n--;
+  
+  return n;
+}
+
+
+/*****************************************************************************/
+/* Computation of the table 'tbl' of the 2^(MSPECC_WNAF_WIDTH-2) odd         */
+/* multiples P, 3P, 5P, ... of a point P given in standard affine            */
+/* coordinates (x,y). The multiples are stored in cached coordinates         */
+/* (U,V,W,Z), i.e. each of them occupies 4*len Words, see ted_extpro_cached. */
+/* The function returns MSPECC_ERR_INVALID_POINT if P is not on the curve.   */
+/*****************************************************************************/
+
+static int ted_wnaf_table(Word *tbl, const AFFPOINT *p, const ECDPARAM *m)
+{
+  int i, err, len = m->len;
+  int num = 1 << (MSPECC_WNAF_WIDTH - 2);  // number of odd multiples of P
+  Word tmp[8*_len];  // temporary space for eight gfp elements
+  Word tpt[4*_len];  // temporary space for a point in cached coordinates
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  PROPOINT t = { tpt, &tpt[len], &tpt[2*len], &tpt[3*len], &tmp[5*len] };
+  PROPOINT a = { NULL, NULL, NULL, NULL, &tmp[5*len] };
+  
+  // validate point P (does P satisfy curve equation?)
+  ted_aff_to_pro(&q, p, m);
+  err = ted_validate(&q, m);
+  if (err != MSPECC_NO_ERROR) return err;
+  
+  // odd multiples (2*i+1)*P in cached coordinates, t is 2*P
+  ted_extpro_cached(&t, &q, m);
+  int_copy(tbl, tpt, 4*len);
+  ted_double(&q, m);
+  ted_extpro_cached(&t, &q, m);
+  ted_aff_to_pro(&q, p, m);
+  for (i = 1; i < num; i++) {
+    ted_add_ext(&q, &t, m);
+    a.x = &tbl[4*i*len];
+    a.y = a.x + len;
+    a.z = a.x + 2*len;
+    a.extra = a.x + 3*len;
+    ted_extpro_cached(&a, &q, m);
+  }
+  
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Point addition R = R + d*P where d is an odd digit of a sliding-window    */
+/* NAF and the table 'tbl' contains the odd multiples of P in cached         */
+/* coordinates (see ted_wnaf_table). The point R is expected to be given in  */
+/* extended projective coordinates. A negative digit is handled by adding    */
+/* the negation of |d|*P, whereby the negation of (U,V,W,Z) is (V,U,-W,Z).   */
+/*****************************************************************************/
+
+static void ted_add_wnaf(PROPOINT *r, const Word *tbl, int d,
+                         const ECDPARAM *m)
+{
+  int len = m->len;
+  Word tpt[4*_len];  // temporary space for a point in cached coordinates
+  Word *u = (Word *) &tbl[4*((d < 0 ? -d : d) >> 1)*len];
+  PROPOINT a = { u, &u[len], &u[2*len], &u[3*len], NULL };
+  
+  if (d < 0) {
+    int_copy(tpt, a.y, len);
+    int_copy(&tpt[len], a.x, len);
+    gfp_cneg(&tpt[2*len], a.z, m->c, 1, len);
+    int_copy(&tpt[3*len], a.extra, len);
+    a.x = tpt;
+    a.y = &tpt[len];
+    a.z = &tpt[2*len];
+    a.extra = &tpt[3*len];
+  }
+  ted_add_ext(r, &a, m);
+}
+
+
+/*****************************************************************************/
+/* Double-base scalar multiplication R = k1*G + k2*P on a twisted Edwards    */
+/* curve, where G is the fixed base point of the domain parameters and P an  */
+/* arbitrary point given in standard affine coordinates (x,y). The scalars   */
+/* k1 and k2 are passed in the DBLSCALAR structure 'k' (elements 'fix' and   */
+/* 'var'). Both multiplications are interleaved (Straus-Shamir trick) and    */
+/* share one chain of doublings: k2 is recoded into a sliding-window NAF     */
+/* (see ted_wnaf_recode) and the odd multiples P, 3P, ..., (2^(W-1)-1)P are  */
+/* computed on the fly in cached coordinates, while k1 is processed by the   */
+/* fixed-base comb (see ted_mul_comb and ted_mul_comb4b), whose columns are  */
+/* added in the last e iterations of the loop. Hence, the comb costs only    */
+/* additions and no doublings. This function is not constant-time (neither   */
+/* the recoding nor the table lookups) and is intended for public scalars,   */
+/* e.g. for the verification of signatures. When the configurable comb is    */
+/* used, k1 must be smaller than 2^(w*len-1). The result R is given in       */
+/* standard affine coordinates.                                              */
+/*****************************************************************************/
+
+int ted_mul_dblbase(AFFPOINT *r, const DBLSCALAR *k, const AFFPOINT *p,
+                    const ECDPARAM *m)
+{
+  int i, n, e, err, len = m->len;
+  Word tmp[8*_len];  // temporary space for eight gfp elements
+  Word tbl[(1 << (MSPECC_WNAF_WIDTH - 2))*4*_len];  // odd multiples of P
+  signed char naf[WSIZE*_len+1];  // sliding-window NAF of k2
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  Word acc[8*_len];  // accumulator R in extended projective coordinates
+  PROPOINT x = { acc, &acc[len], &acc[2*len], &acc[3*len], &acc[5*len] };
+#ifdef MSPECC_COMB_TEETH
+  Word kr[_len+1];   // recoded scalar k1
+  int j, s, cols = (WSIZE*len + MSPECC_COMB_TEETH - 1)/MSPECC_COMB_TEETH;
+  int sub = 0;
+#endif
+  
+  // validate point P and compute the table of its odd multiples
+  err = ted_wnaf_table(tbl, p, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // recoding of the scalars, e is the number of columns per comb
+  n = ted_wnaf_recode(naf, k->var, len);
+  e = (WSIZE >> 2)*len;
+#ifdef MSPECC_COMB_TEETH
+  if (m->ctb != NULL) {
+    // the signed comb requires k1 < 2^(w*len-1)
+    if (k->fix[len-1] >> (WSIZE-1)) {
+      ted_set0_aff(r, len);
+      return MSPECC_ERR_INVALID_SCALAR;
+    }
+    sub = ted_comb_recode(kr, k->fix, MSPECC_COMB_TEETH*cols, m);
+    e = (cols + MSPECC_COMB_COMBS - 1)/MSPECC_COMB_COMBS;
+  }
+#endif
+  if (n < e) n = e;
+  
+  // interleaved loop, R is initialized with the neutral element (0,1,1,0,1)
+  ted_set0_pro(&x, len);
+  int_set(x.extra, 0, len);
+  int_set(&(x.extra[len]), 1, len);
+  for (i = n - 1; i >= 0; i--) {
+    if (i < n - 1) ted_double(&x, m);
+    if (naf[i] != 0) ted_add_wnaf(&x, tbl, naf[i], m);
+    if (i >= e) continue;
+#ifdef MSPECC_COMB_TEETH
+    if (m->ctb != NULL) {
+      for (s = 0; s < MSPECC_COMB_COMBS; s++) {
+        j = s*e + i;
+        if (j >= cols) continue;
+        ted_load_column(&q, kr, j, cols, e, 0, m);
+        ted_add(&x, &q, m);
+      }
+      continue;
+    }
+#endif
+    ted_load_entry(&q, m->tbl, get_digit(k->fix, i, len), 16, len, 0);
+    ted_add(&x, &q, m);
+  }
+#ifdef MSPECC_COMB_TEETH
+  if ((m->ctb != NULL) && (m->ord == NULL)) ted_comb_correct(&x, sub, 0, m);
+#endif
+  
+  // convert result from projective to affine coordinates
+  err = ted_proj_affine(&x, &x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // validate point R (does R satisfy curve equation?)
+  err = ted_validate(&x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // assign x and y-coordinate of point R to output
+  int_copy(r->x, x.x, len);
+  int_copy(r->y, x.y, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Multi-scalar multiplication R = k[0]*P[0] + ... + k[n-1]*P[n-1] on a      */
+/* twisted Edwards curve, where the points P[i] are given in standard affine */
+/* coordinates (x,y) and the n scalars of len Words each are stored          */
+/* consecutively in the array 'k'. The multiplications are interleaved       */
+/* (Straus' method): all scalars are recoded into sliding-window NAFs and    */
+/* share one chain of doublings, so that each point costs only the additions */
+/* of its non-zero digits and the computation of its table of odd multiples. */
+/* The points are processed in chunks of MSPECC_MAX_MULTI, each with its own */
+/* chain of doublings, to bound the stack usage. The scalars may have the    */
+/* full length of w*len bits. This function is not constant-time and is      */
+/* intended for public scalars, e.g. for batch verification of signatures.   */
+/* The result R is given in standard affine coordinates.                     */
+/*****************************************************************************/
+
+int ted_mul_multi(AFFPOINT *r, const Word *k, const AFFPOINT *p, int n,
+                  const ECDPARAM *m)
+{
+  int h, i, j, b, d, err, len = m->len;
+  int num = 1 << (MSPECC_WNAF_WIDTH - 2);  // number of odd multiples of P
+  Word tbl[MSPECC_MAX_MULTI*(1 << (MSPECC_WNAF_WIDTH - 2))*4*_len];
+  signed char naf[MSPECC_MAX_MULTI*(WSIZE*_len+1)];  // NAFs of a chunk
+  Word tmp[8*_len];  // temporary space for eight gfp elements
+  Word tpt[4*_len];  // temporary space for a point in cached coordinates
+  PROPOINT s = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  PROPOINT t = { tpt, &tpt[len], &tpt[2*len], &tpt[3*len], &tmp[5*len] };
+  Word acc[8*_len];  // accumulator R in extended projective coordinates
+  PROPOINT x = { acc, &acc[len], &acc[2*len], &acc[3*len], &acc[5*len] };
+  
+  // R is initialized with the neutral element (0,1,1,0,1)
+  ted_set0_pro(&x, len);
+  int_set(x.extra, 0, len);
+  int_set(&(x.extra[len]), 1, len);
+  
+  for (h = 0; h < n; h += MSPECC_MAX_MULTI) {
+    b = ((n - h) < MSPECC_MAX_MULTI) ? (n - h) : MSPECC_MAX_MULTI;
+    
+    // tables of odd multiples and recoding of the scalars of the chunk, d
+    // is the length of the longest NAF
+    for (d = 0, j = 0; j < b; j++) {
+      err = ted_wnaf_table(&tbl[j*num*4*len], &p[h+j], m);
+      if (err != MSPECC_NO_ERROR) {
+        ted_set0_aff(r, len);
+        return err;
+      }
+      i = ted_wnaf_recode(&naf[j*(WSIZE*len+1)], &k[(h+j)*len], len);
+      if (i > d) d = i;
+    }
+    
+    // interleaved loop, the sum S of the chunk starts with the neutral
+    // element (0,1,1,0,1)
+    ted_set0_pro(&s, len);
+    int_set(s.extra, 0, len);
+    int_set(&(s.extra[len]), 1, len);
+    for (i = d - 1; i >= 0; i--) {
+      if (i < d - 1) ted_double(&s, m);
+      for (j = 0; j < b; j++) {
+        if (naf[j*(WSIZE*len+1)+i] == 0) continue;
+        ted_add_wnaf(&s, &tbl[j*num*4*len], naf[j*(WSIZE*len+1)+i], m);
+      }
+    }
+    
+    // R = R + S, the first sum is copied
+    if (h == 0) {
+      ted_copy(&x, &s, len, 5);
+    } else {
+      ted_extpro_cached(&t, &s, m);
+      ted_add_ext(&x, &t, m);
+    }
+  }
+  
+  // convert result from projective to affine coordinates
+  err = ted_proj_affine(&x, &x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // validate point R (does R satisfy curve equation?)
+  err = ted_validate(&x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // assign x and y-coordinate of point R to output
+  int_copy(r->x, x.x, len);
+  int_copy(r->y, x.y, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
+/*****************************************************************************/
+/* Signed digit of window j of a scalar 'k' for the bucket method with a     */
+/* window width of c bits: the digits are d[j] = k[j] + carry[j] -           */
+/* 2^c*carry[j+1] where k[j] are the c-bit windows of k and carry[j+1] = 1   */
+/* if k[j] + carry[j] > 2^(c-1), i.e. -2^(c-1) < d[j] <= 2^(c-1). Since      */
+/* carry[j] is known as soon as a lower window differs from 2^(c-1), the     */
+/* digit is computed without recoding the whole scalar (usually from two     */
+/* windows).                                                                 */
+/*****************************************************************************/
+
+static int ted_msm_digit(const Word *k, int j, int c, int len)
+{
+  int i, b, d, h = 1 << (c - 1), carry = 0, n = WSIZE*len;
+  
+  for (i = j - 1; i >= 0; i--) {
+    for (d = 0, b = c - 1; b >= 0; b--) {
+      if (c*i + b < n) d = (d << 1) | (int) GET_BIT(k, c*i + b);
+      else d <<= 1;
+    }
+    if (d != h) {
+      carry = (d > h);
+      break;
+    }
+  }
+  for (d = 0, b = c - 1; b >= 0; b--) {
+    if (c*j + b < n) d = (d << 1) | (int) GET_BIT(k, c*j + b);
+    else d <<= 1;
+  }
+  d += carry;
+  
+  return (d > h) ? (d - 2*h) : d;
+}
+
+
+/*****************************************************************************/
+/* Sum W = d[0]*P[0] + d[1]*P[1] + ... + d[n-1]*P[n-1] of the signed digits  */
+/* of window j of the n scalars (see ted_msm_digit) with the bucket method:  */
+/* each point P[i] is added to (or, for a negative digit, subtracted from)   */
+/* bucket |d[i]|, whereby the buckets are kept in extended projective        */
+/* coordinates and the points are converted to extended affine coordinates   */
+/* on the fly, so that ted_add can be used. The buckets are then summed up   */
+/* with two running sums in standard projective coordinates (ted_add_pro),   */
+/* which yields W = sum of b*B[b] with 2^c additions. Empty buckets are      */
+/* skipped. The result W is written in standard projective coordinates       */
+/* (X,Y,Z) to the 3*len Words of 'w'.                                        */
+/*****************************************************************************/
+
+static void ted_msm_window(Word *w, const Word *k, const AFFPOINT *p, int n,
+                           int c, int j, const ECDPARAM *m)
+{
+  int i, b, d, len = m->len, h = 1 << (c - 1), s0 = 0, t0 = 0;
+  Word bkt[(1 << (MSPECC_MSM_MAX_WINDOW - 1))*5*_len];  // buckets
+  char used[1 << (MSPECC_MSM_MAX_WINDOW - 1)];  // non-empty buckets
+  Word tmp[8*_len];  // temporary space for eight gfp elements
+  Word acc[10*_len];  // running sums S and T
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], NULL, &tmp[5*len] };
+  PROPOINT a = { NULL, NULL, NULL, NULL, &tmp[5*len] };
+  PROPOINT s = { acc, &acc[len], &acc[2*len], &acc[3*len], &tmp[5*len] };
+  PROPOINT t = { &acc[5*len], &acc[6*len], &acc[7*len], &acc[8*len],
+                 &tmp[5*len] };
+  AFFPOINT r = { &tmp[3*len], NULL };
+  
+  for (b = 0; b < h; b++) used[b] = 0;
+  
+  // accumulation of the points in the buckets, -P = (-x,y)
+  for (i = 0; i < n; i++) {
+    d = ted_msm_digit(&k[i*len], j, c, len);
+    if (d == 0) continue;
+    r.y = p[i].y;
+    gfp_cneg(r.x, p[i].x, m->c, (d < 0), len);
+    ted_affine_extaff(&q, &r, m);
+    b = ((d < 0) ? -d : d) - 1;
+    a.x = &bkt[5*b*len];
+    a.y = a.x + len;
+    a.z = a.x + 2*len;
+    a.extra = a.x + 3*len;
+    if (used[b]) {
+      ted_add(&a, &q, m);
+    } else {
+      ted_extaff_extpro(&a, &q, m);
+      used[b] = 1;
+    }
+  }
+  
+  // running sums S = B[h-1] + ... + B[b] and T = S[h-1] + ... + S[0]
+  for (b = h - 1; b >= 0; b--) {
+    if (used[b]) {
+      a.x = &bkt[5*b*len];
+      a.y = a.x + len;
+      a.z = a.x + 2*len;
+      if (s0) ted_add_pro(&s, &a, m);
+      else ted_copy(&s, &a, len, 3);
+      s0 = 1;
+    }
+    if (!s0) continue;
+    if (t0) ted_add_pro(&t, &s, m);
+    else ted_copy(&t, &s, len, 3);
+    t0 = 1;
+  }
+  
+  if (t0) {
+    int_copy(w, t.x, 3*len);
+  } else {
+    int_set(w, 0, len);
+    int_set(&w[len], 1, len);
+    int_set(&w[2*len], 1, len);
+  }
+}
+
+
+#if (MSPECC_MSM_THREADS > 1)
+// windows j = first, first + step, ... of the bucket method for one thread
+typedef struct msm_task {
+  Word *w;
+  const Word *k;
+  const AFFPOINT *p;
+  const ECDPARAM *m;
+  int n, c, nwin, first, step;
+} MSMTASK;
+
+static void *ted_msm_thread(void *arg)
+{
+  MSMTASK *t = (MSMTASK *) arg;
+  int j, len = t->m->len;
+  
+  for (j = t->first; j < t->nwin; j += t->step) {
+    ted_msm_window(&(t->w[3*j*len]), t->k, t->p, t->n, t->c, j, t->m);
+  }
+  
+  return NULL;
+}
+#endif
+
+
+/*****************************************************************************/
+/* Selection of the window width c of the bucket method for n scalars of b   */
+/* bits: each of the b/c + 1 windows costs n additions of points to buckets  */
+/* and about 2^c additions for the summation of the buckets, hence c is      */
+/* chosen such that (b/c + 1)*(n + 2^c) is minimal (c grows with log2(n)).   */
+/*****************************************************************************/
+
+static int ted_msm_width(int n, int b)
+{
+  int c, best = 1;
+  long cost, min = -1;
+  
+  for (c = 1; c <= MSPECC_MSM_MAX_WINDOW; c++) {
+    cost = (long) (b/c + 1)*((long) n + (1L << c));
+    if ((min < 0) || (cost < min)) {
+      min = cost;
+      best = c;
+    }
+  }
+  
+  return best;
+}
+
+
+/*****************************************************************************/
+/* Multi-scalar multiplication R = k[0]*P[0] + ... + k[n-1]*P[n-1] on a      */
+/* twisted Edwards curve using the bucket method of Pippenger. The points    */
+/* P[i] are given in standard affine coordinates (x,y) and the n scalars of  */
+/* len Words each are stored consecutively in the array 'k'. The scalars are */
+/* split into signed windows of c bits, where c is selected according to n   */
+/* (see ted_msm_width), and the sums of the windows (see ted_msm_window) are */
+/* combined with c doublings each. In contrast to ted_mul_multi, the cost    */
+/* per point decreases with n (about (w*len)/log2(n) additions), which makes */
+/* it the method of choice for large n. When MSPECC_MSM_THREADS > 1, the     */
+/* windows are distributed among that number of threads (POSIX threads),     */
+/* which work on separate buckets. This function is not constant-time and is */
+/* intended for public scalars. The result R is given in standard affine     */
+/* coordinates.                                                              */
+/*****************************************************************************/
+
+int ted_msm(AFFPOINT *r, const Word *k, const AFFPOINT *p, int n,
+            const ECDPARAM *m)
+{
+  int i, j, c, nwin, err, len = m->len;
+#if (MSPECC_MSM_THREADS > 1)
+  Word wsum[(WSIZE*_len+1)*3*_len];  // sums of all windows
+#else
+  Word wsum[3*_len];  // sum of the current window
+#endif
+  Word tmp[8*_len];  // temporary space for eight gfp elements
+  Word acc[8*_len];  // accumulator R in (extended) projective coordinates
+  PROPOINT q = { tmp, &tmp[len], &tmp[2*len], &tmp[3*len], &tmp[5*len] };
+  PROPOINT x = { acc, &acc[len], &acc[2*len], &acc[3*len], &acc[5*len] };
+  PROPOINT a = { NULL, NULL, NULL, NULL, NULL };
+#if (MSPECC_MSM_THREADS > 1)
+  pthread_t thr[MSPECC_MSM_THREADS];
+  MSMTASK task[MSPECC_MSM_THREADS];
+  int nthr, started[MSPECC_MSM_THREADS];
+#endif
+  
+  // validate the points P[i] (do they satisfy the curve equation?)
+  for (i = 0; i < n; i++) {
+    ted_aff_to_pro(&q, &p[i], m);
+    err = ted_validate(&q, m);
+    if (err != MSPECC_NO_ERROR) {
+      ted_set0_aff(r, len);
+      return err;
+    }
+  }
+  
+  // window width and sums of the windows
+  c = ted_msm_width(n, WSIZE*len);
+  nwin = (WSIZE*len)/c + 1;
+#if (MSPECC_MSM_THREADS > 1)
+  nthr = (nwin < MSPECC_MSM_THREADS) ? nwin : MSPECC_MSM_THREADS;
+  for (i = 0; i < nthr; i++) {
+    task[i].w = wsum;
+    task[i].k = k;
+    task[i].p = p;
+    task[i].m = m;
+    task[i].n = n;
+    task[i].c = c;
+    task[i].nwin = nwin;
+    task[i].first = i;
+    task[i].step = nthr;
+    // the first task (and any task whose thread can not be created) is
+    // executed by the calling thread
+    started[i] = (i > 0) &&
+                 (pthread_create(&thr[i], NULL, ted_msm_thread, &task[i]) == 0);
+  }
+  for (i = 0; i < nthr; i++) {
+    if (!started[i]) ted_msm_thread(&task[i]);
+  }
+  for (i = 1; i < nthr; i++) {
+    if (started[i]) pthread_join(thr[i], NULL);
+  }
+  int_copy(acc, &wsum[3*(nwin-1)*len], 3*len);
+#else
+  ted_msm_window(acc, k, p, n, c, nwin - 1, m);
+#endif
+  
+  // R = sum of 2^(c*j)*W[j] by Horner's rule; without threads, the windows
+  // are computed one by one from the top, so only one sum W[j] is stored
+  for (j = nwin - 2; j >= 0; j--) {
+    for (i = 0; i < c; i++) ted_double(&x, m);
+#if (MSPECC_MSM_THREADS > 1)
+    a.x = &wsum[3*j*len];
+#else
+    ted_msm_window(wsum, k, p, n, c, j, m);
+    a.x = wsum;
+#endif
+    a.y = a.x + len;
+    a.z = a.x + 2*len;
+    ted_add_pro(&x, &a, m);
+  }
+  
+  // convert result from projective to affine coordinates
+  err = ted_proj_affine(&x, &x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // validate point R (does R satisfy curve equation?)
+  err = ted_validate(&x, m);
+  if (err != MSPECC_NO_ERROR) {
+    ted_set0_aff(r, len);
+    return err;
+  }
+  
+  // assign x and y-coordinate of point R to output
+  int_copy(r->x, x.x, len);
+  int_copy(r->y, x.y, len);
+  
+  return MSPECC_NO_ERROR;
+}
+
+
 /*****************************************************************************/
 /* Convert a point P on a twisted Edwards curve to the corresponding point R */
 /* on the birationally equivalent Montgomery curve. The point P is expected  */
@@ -605,7 +1583,7 @@ void ted_test25519(void)
   Word k[256/WSIZE] = {                                             \
     0x7c30, 0x8683, 0x284f, 0xcb33, 0x7a42, 0xf12e, 0x0ac0, 0x3c01, \
     0xfffd, 0x6827, 0x80d9, 0xa3c0, 0x20a5, 0x06f0, 0x4d90, 0x4fe9 };
-  #else  // WSIZE == 32
+  #elif (WSIZE == 32)
   // point P = (xp, yp)
   Word xp[256/WSIZE] = {                            \
     0x8f25d51a, 0xc9562d60, 0x9525a7b2, 0x692cc760, \
@@ -618,6 +1596,19 @@ void ted_test25519(void)
   Word k[256/WSIZE] = {                             \
     0x86837c30, 0xcb33284f, 0xf12e7a42, 0x3c010ac0, \
     0x6827fffd, 0xa3c080d9, 0x06f020a5, 0x4fe94d90 };
+  #else  // WSIZE == 64
+  // point P = (xp, yp)
+  Word xp[256/WSIZE] = {                    \
+    0xc9562d608f25d51a, 0x692cc7609525a7b2, \
+    0xc0a4e231fdd6dc5c, 0x216936d3cd6e53fe };
+  Word yp[256/WSIZE] = {                    \
+    0x6666666666666658, 0x6666666666666666, \
+    0x6666666666666666, 0x6666666666666666 };
+  AFFPOINT p = { xp, yp };
+  // scalar k (hashed and pruned key, see RFC 8032)
+  Word k[256/WSIZE] = {                     \
+    0xcb33284f86837c30, 0x3c010ac0f12e7a42, \
+    0xa3c080d96827fffd, 0x4fe94d9006f020a5 };
   #endif  
   // result point R = k*P = (xr, yr)
   Word xr[256/WSIZE], yr[256/WSIZE];
@@ -629,7 +1620,7 @@ void ted_test25519(void)
   
   // pruning: make sure that scalar k is a valid scalar
   // k[len-1] &= (((Word) -1L) >> 1);            // 0x7F..FF 
-  // k[len-1] |= ((Word) (1UL << (WSIZE - 2)));  // 0x40..00 
+  // k[len-1] |= (((Word) 1) << (WSIZE - 2));  // 0x40..00 
   // k[0]     &= ((Word) -8L);                   // 0xFF..F8
   
   #ifdef MSPECC_DEBUG_PRINT
@@ -27,14 +27,26 @@
 
 void ted_copy(PROPOINT *r, const PROPOINT *p, int len, int num);
 void ted_add(PROPOINT *p, const PROPOINT *q, const ECDPARAM *m);
+void ted_add_ext(PROPOINT *p, const PROPOINT *q, const ECDPARAM *m);
 void ted_double(PROPOINT *p, const ECDPARAM *m);
 int  ted_validate(const PROPOINT *p, const ECDPARAM *m);
 void ted_mul_binary(PROPOINT *r, const Word *k, const AFFPOINT *p, const ECDPARAM *m);
+void ted_load_point(PROPOINT *r, int i, const ECDPARAM *m);
 void ted_mul_comb4b(PROPOINT *r, const Word *k, const ECDPARAM *m);
+void ted_mul_comb(PROPOINT *r, const Word *k, const ECDPARAM *m);
+void ted_set0_pro(PROPOINT *p, int len);
+void ted_aff_to_pro(PROPOINT *r, const AFFPOINT *p, const ECDPARAM *m);
+void ted_affine_extaff(PROPOINT *r, const AFFPOINT *p, const ECDPARAM *m);
+void ted_extaff_extpro(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
+void ted_extpro_cached(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
 void ted_to_mon(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
 int  ted_proj_affine(PROPOINT *r, const PROPOINT *p, const ECDPARAM *m);
+void ted_compress(Word *a, const AFFPOINT *p, const ECDPARAM *m);
+int  ted_decompress(AFFPOINT *r, const Word *a, const ECDPARAM *m);
 int  ted_mul_varbase(AFFPOINT *q, const Word *k, const AFFPOINT *p, const ECDPARAM *m);
 int  ted_mul_fixbase(AFFPOINT *r, const Word *k, const ECDPARAM *m);
 int  ted_mul_dblbase(AFFPOINT *r, const DBLSCALAR *k, const AFFPOINT *p, const ECDPARAM *m);
+int  ted_mul_multi(AFFPOINT *r, const Word *k, const AFFPOINT *p, int n, const ECDPARAM *m);
+int  ted_msm(AFFPOINT *r, const Word *k, const AFFPOINT *p, int n, const ECDPARAM *m);
 
 #endif
@@ -2,6 +2,14 @@
 #include "disco_symmetric.h"
 #include <stdio.h>
 #include "moncurve.h"
+#include "tedcurve.h"
+#include "gfparith.h"
+#include "intarith.h"
+#include "ecdparam.h"
+#include "sha512.h"
+#include "ed25519.h"
+#include "sclarith.h"
+#include "xoodoo.h"
 
 void test_N() {
   // generate server keypair
@@ -386,6 +394,753 @@ void test_Hash() {
   assert(different);
 }
 
+void test_Xoodoo() {
+  // Xoodoo[12] of the all-zero state (known answer of the specification),
+  // for the single-state permutation (C99 or Assembler) and for every lane
+  // of the multi-state permutations
+  const uint8_t res[XOODOO_STATE_BYTES] =
+      "\x8d\xd8\xd5\x89\xbf\xfc\x63\xa9\x19\x2d\x23\x1b\x14\xa0\xa5\xff"
+      "\x06\x81\xb1\x36\xfe\xc1\xc7\xaf\xbe\x7c\xe5\xae\xbd\x40\x75\xa7"
+      "\x70\xe8\x86\x2e\xc9\xb7\xf5\xfe\xf2\xad\x4f\x8b\x62\x40\x4f\x5e";
+  uint8_t st[8][XOODOO_STATE_BYTES];
+  uint8_t *pst[8];
+
+  memset(st, 0, sizeof(st));
+  xoodoo_perm(st[0], XOODOO_MAX_ROUNDS);
+  assert(memcmp(st[0], res, XOODOO_STATE_BYTES) == 0);
+
+  memset(st, 0, sizeof(st));
+  for (int i = 0; i < 8; i++) {
+    pst[i] = st[i];
+  }
+  xoodoo_perm_x4(pst, XOODOO_MAX_ROUNDS);
+  for (int i = 0; i < 4; i++) {
+    assert(memcmp(st[i], res, XOODOO_STATE_BYTES) == 0);
+  }
+  memset(st, 0, sizeof(st));
+  xoodoo_perm_x8(pst, XOODOO_MAX_ROUNDS);
+  for (int i = 0; i < 8; i++) {
+    assert(memcmp(st[i], res, XOODOO_STATE_BYTES) == 0);
+  }
+  printf("Xoodoo permutation: ok\n");
+}
+
+void test_StrobeBatch() {
+  // five sessions: batched operations must match the sequential ones
+  strobe_s seq[5], bat[5];
+  strobe_s *pbat[5];
+  uint8_t buf_seq[5][40], buf_bat[5][40];
+  uint8_t *pbuf[5];
+  size_t lens[5];
+
+  for (int i = 0; i < 5; i++) {
+    uint8_t key[16] = "0123456789abcde";
+    strobe_init(&seq[i], "batch", 5);
+    strobe_operate(&seq[i], TYPE_KEY, key, 16, false);
+    bat[i] = seq[i];
+    pbat[i] = &bat[i];
+    pbuf[i] = buf_bat[i];
+    lens[i] = 8 * i + 3;  // crosses the rate for i >= 2
+    for (int j = 0; j < 40; j++) {
+      buf_seq[i][j] = buf_bat[i][j] = (uint8_t)(i + j);
+    }
+  }
+
+  // encrypt and send a MAC
+  for (int i = 0; i < 5; i++) {
+    strobe_operate(&seq[i], TYPE_ENC, buf_seq[i], lens[i], false);
+  }
+  strobe_operate_batch(pbat, TYPE_ENC, pbuf, lens, 5, false, NULL);
+  for (int i = 0; i < 5; i++) {
+    lens[i] = 16;
+    strobe_operate(&seq[i], TYPE_MAC, buf_seq[i], 16, false);
+  }
+  strobe_operate_batch(pbat, TYPE_MAC, pbuf, lens, 5, false, NULL);
+
+  for (int i = 0; i < 5; i++) {
+    assert(memcmp(&seq[i].state, &bat[i].state, sizeof(kdomain_s)) == 0);
+    assert(seq[i].position == bat[i].position);
+    assert(memcmp(buf_seq[i], buf_bat[i], 40) == 0);
+  }
+  printf("batched strobe operations: ok\n");
+}
+
+void test_GfpInv() {
+  // a*a^(-1) must be 1 for p = 2^255 - 19 (addition chain) and for
+  // p = 2^127 - 1 (binary method), and all inversions must agree
+  const int lens[2] = { 256 / WSIZE, 128 / WSIZE };
+  const Word cs[2] = { 19, 1 };
+  Word a[256 / WSIZE], r1[256 / WSIZE], r2[256 / WSIZE], t[256 / WSIZE];
+  uint64_t x = 0x243F6A8885A308D3ULL;
+
+  for (int n = 0; n < 2; n++) {
+    int len = lens[n];
+    Word c = cs[n];
+    for (int j = 0; j < 20; j++) {
+      for (int i = 0; i < len; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        a[i] = (Word) x;
+      }
+      a[len - 1] &= ((Word) -1) >> 1;
+      assert(gfp_inv_fermat(r1, a, c, len) == MSPECC_NO_ERROR);
+      assert(gfp_inv(r2, a, c, len) == MSPECC_NO_ERROR);
+      gfp_mul(t, a, r1, c, len);
+      gfp_lnr(t, t, c, len);
+      assert(int_is1(t, len));
+      assert(gfp_cmp(r1, r2, c, len) == 0);
+      assert(gfp_inv_sgcd(r2, a, c, len) == MSPECC_NO_ERROR);
+      assert(gfp_cmp(r1, r2, c, len) == 0);
+    }
+    // 0 and p have no inverse
+    int_set(a, 0, len);
+    assert(gfp_inv_fermat(r1, a, c, len) == MSPECC_ERR_INVERSION_ZERO);
+    assert(gfp_inv_sgcd(r1, a, c, len) == MSPECC_ERR_INVERSION_ZERO);
+    gfp_set(a, c, len);
+    assert(gfp_inv_fermat(r1, a, c, len) == MSPECC_ERR_INVERSION_ZERO);
+    assert(gfp_inv_sgcd(r1, a, c, len) == MSPECC_ERR_INVERSION_ZERO);
+    // a batch of no elements must not access r
+    assert(gfp_inv_batch(NULL, a, 0, c, len) == MSPECC_NO_ERROR);
+  }
+  printf("field inversion: ok\n");
+}
+
+void test_GfpMul32Add() {
+  // a*b + d with a single reduction must match gfp_mul32 followed by gfp_add,
+  // also for operands of all-1 words (largest unreduced product)
+  enum { LEN = 256 / WSIZE };
+  Word a[LEN], d[LEN], r1[LEN], r2[LEN], b[(32 + WSIZE - 1) / WSIZE];
+  uint64_t x = 0x452821E638D01377ULL;
+
+  for (int j = 0; j < 21; j++) {
+    for (int i = 0; i < LEN; i++) {
+      x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+      a[i] = (j == 20) ? (Word) -1 : (Word) x;
+      d[i] = (j == 20) ? (Word) -1 : (Word) (x >> 5);
+    }
+    uint32_t b32 = (j >= 19) ? 0xFFFFFFFFUL : (uint32_t) (x >> 20);
+    for (int i = 0; i < (32 + WSIZE - 1) / WSIZE; i++) {
+      b[i] = (Word) (b32 >> (i * WSIZE));
+    }
+    gfp_mul32add(r1, a, b, d, 19, LEN);
+    gfp_mul32(r2, a, b, 19, LEN);
+    gfp_add(r2, r2, d, 19, LEN);
+    assert(gfp_cmp(r1, r2, 19, LEN) == 0);
+  }
+  printf("multiplication by 32-bit integer and addition: ok\n");
+}
+
+void test_Karatsuba() {
+  // Karatsuba multiplication and squaring must match the schoolbook method,
+  // also for operands of all-1 words (largest sums of the half products)
+  enum { LEN = 256 / WSIZE };
+  Word a[LEN], b[LEN], r1[2 * LEN], r2[2 * LEN];
+  uint64_t x = 0xBE5466CF34E90C6CULL;
+
+  for (int j = 0; j < 21; j++) {
+    for (int i = 0; i < LEN; i++) {
+      x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+      a[i] = (j == 20) ? (Word) -1 : (Word) x;
+      b[i] = (j == 20) ? (Word) -1 : (Word) (x >> 9) ^ (Word) (x << 3);
+    }
+    int_mul_kara(r1, a, b, LEN);
+    int_mul_c99(r2, a, b, LEN);
+    assert(memcmp(r1, r2, sizeof(r1)) == 0);
+    int_sqr_kara(r1, a, LEN);
+    int_sqr_c99(r2, a, LEN);
+    assert(memcmp(r1, r2, sizeof(r1)) == 0);
+    a[LEN - 1] &= ((Word) -1) >> 1;
+    b[LEN - 1] &= ((Word) -1) >> 1;
+    gfp_mul_kara(r1, a, b, 19, LEN);
+    gfp_mul_c99(r2, a, b, 19, LEN);
+    assert(gfp_cmp(r1, r2, 19, LEN) == 0);
+    gfp_sqr_kara(r1, a, 19, LEN);
+    gfp_sqr_c99(r2, a, 19, LEN);
+    assert(gfp_cmp(r1, r2, 19, LEN) == 0);
+  }
+
+  // long operands of MSPECC_KARA_MAX_LEN (at least 4*MSPECC_KARA_THRESHOLD)
+  // Words for several levels of recursion, an even length whose halves are
+  // odd and above the threshold (schoolbook fallback inside the recursion),
+  // and an odd length
+  enum { MAX = MSPECC_KARA_MAX_LEN };
+  static Word la[MAX], lb[MAX], lr1[2 * MAX], lr2[2 * MAX];
+  const int lens[3] = { MAX, 2 * (MSPECC_KARA_THRESHOLD + 1), MAX - 1 };
+
+  for (int l = 0; l < 3; l++) {
+    int n = lens[l];
+    if (n > MAX) continue;
+    for (int j = 0; j < 3; j++) {
+      for (int i = 0; i < n; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        la[i] = (j == 2) ? (Word) -1 : (Word) x;
+        lb[i] = (j == 2) ? (Word) -1 : (Word) (x >> 9) ^ (Word) (x << 3);
+      }
+      int_mul_kara(lr1, la, lb, n);
+      int_mul(lr2, la, lb, n);
+      assert(memcmp(lr1, lr2, 2 * n * sizeof(Word)) == 0);
+      int_sqr_kara(lr1, la, n);
+      int_sqr(lr2, la, n);
+      assert(memcmp(lr1, lr2, 2 * n * sizeof(Word)) == 0);
+    }
+  }
+  printf("Karatsuba multiplication and squaring: ok\n");
+}
+
+void test_X25519() {
+  // test vector of RFC 7748 (Section 5.2) with the constant-time ladder
+  static const uint8_t kb[32] = {
+    0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15,
+    0x4b, 0x82, 0x46, 0x5e, 0xdd, 0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc,
+    0x5a, 0x18, 0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4 };
+  static const uint8_t ub[32] = {
+    0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1,
+    0xa4, 0x24, 0xb1, 0x5f, 0x7c, 0x72, 0x66, 0x24, 0xec, 0x26, 0xb3,
+    0x35, 0x3b, 0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c };
+  static const uint8_t rb[32] = {
+    0xc3, 0xda, 0x55, 0x37, 0x9d, 0xe9, 0xc6, 0x90, 0x8e, 0x94, 0xea,
+    0x4d, 0xf2, 0x8d, 0x08, 0x4f, 0x32, 0xec, 0xcf, 0x03, 0x49, 0x1c,
+    0x71, 0xf7, 0x54, 0xb4, 0x07, 0x55, 0x77, 0xa2, 0x85, 0x52 };
+  enum { LEN = 256 / WSIZE };
+  Word k[LEN], u[LEN], r[LEN];
+  uint8_t *kp = (uint8_t *) k, *up = (uint8_t *) u;
+
+  memcpy(k, kb, 32);
+  memcpy(u, ub, 32);
+  kp[0] &= 0xF8; kp[31] &= 0x7F; kp[31] |= 0x40;
+  up[31] &= 0x7F;
+  assert(mon_mul_varbase(r, k, u, &CURVE25519) == MSPECC_NO_ERROR);
+  assert(memcmp(r, rb, 32) == 0);
+  // scalars with bit 255 set are not supported by the 255-step ladder
+  kp[31] |= 0x80;
+  assert(mon_mul_varbase(r, k, u, &CURVE25519) == MSPECC_ERR_INVALID_SCALAR);
+  assert(int_is0(r, LEN));
+  printf("X25519 (RFC 7748): ok\n");
+}
+
+void test_MonBatch() {
+  // batched scalar multiplications must match the single ones (11 results
+  // cross a chunk boundary), a scalar of 0 must only affect its own result
+  enum { NUM = 11, LEN = 256 / WSIZE };
+  Word k[NUM * LEN], x[NUM * LEN], r1[NUM * LEN], r2[LEN];
+  uint64_t s = 0x13198A2E03707344ULL;
+
+  for (int i = 0; i < NUM * LEN; i++) {
+    s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+    k[i] = (Word) s;
+    s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+    x[i] = (Word) s;
+  }
+  for (int i = 0; i < NUM; i++) {
+    k[i * LEN + LEN - 1] &= ((Word) -1) >> 1;
+    x[i * LEN + LEN - 1] &= ((Word) -1) >> 1;
+  }
+  int_set(&k[5 * LEN], 0, LEN);
+
+  assert(mon_mul_varbase_batch(r1, k, x, NUM, &CURVE25519) ==
+         MSPECC_ERR_INVALID_SCALAR);
+  for (int i = 0; i < NUM; i++) {
+    int err = mon_mul_varbase(r2, &k[i * LEN], &x[i * LEN], &CURVE25519);
+    assert(err == ((i == 5) ? MSPECC_ERR_INVALID_SCALAR : MSPECC_NO_ERROR));
+    assert(memcmp(r2, &r1[i * LEN], sizeof(r2)) == 0);
+  }
+  assert(mon_mul_fixbase_batch(r1, k, NUM, &CURVE25519) ==
+         MSPECC_ERR_INVALID_SCALAR);
+  for (int i = 0; i < NUM; i++) {
+    if (i == 5) {
+      assert(int_is0(&r1[i * LEN], LEN));
+      continue;
+    }
+    assert(mon_mul_fixbase(r2, &k[i * LEN], &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r2, &r1[i * LEN], sizeof(r2)) == 0);
+  }
+  printf("batched scalar multiplications: ok\n");
+}
+
+void test_FixBase() {
+  // the fixed-base comb (configurable table or 16-point table) must match
+  // the ladder with the base point u = 9, also for the scalars 1 and 2^255-1
+  // (odd scalars need no correction in the signed recoding), and a scalar
+  // with the MSB set must be rejected
+  enum { LEN = 256 / WSIZE };
+  Word k[LEN], u[LEN], r1[LEN], r2[LEN];
+  uint64_t s = 0xA4093822299F31D0ULL;
+
+  int_set(u, 9, LEN);
+  for (int j = 0; j < 16; j++) {
+    for (int i = 0; i < LEN; i++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k[i] = (j == 14) ? (Word) -1 : (Word) s;
+    }
+    k[LEN - 1] &= ((Word) -1) >> 1;
+    if (j == 15) int_set(k, 1, LEN);
+    assert(mon_mul_fixbase(r1, k, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(mon_mul_varbase(r2, k, u, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r1, r2, sizeof(r1)) == 0);
+  }
+  k[LEN - 1] |= ((Word) 1) << (WSIZE - 1);
+  assert(mon_mul_fixbase(r1, k, &CURVE25519) == MSPECC_ERR_INVALID_SCALAR);
+
+  // without the order of the base point (ord = NULL, as for the curves of
+  // gen_param), the signed comb corrects even scalars by subtracting G
+  const ECDPARAM noord = { CURVE25519.len, CURVE25519.c, CURVE25519.a24,
+    CURVE25519.dte, CURVE25519.rma, CURVE25519.rm1, CURVE25519.tbl,
+    CURVE25519.ctb, NULL, NULL };
+  for (int j = 0; j < 8; j++) {
+    for (int i = 0; i < LEN; i++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k[i] = (Word) s;
+    }
+    k[0] = (k[0] & ~((Word) 1)) | (Word) (j & 1);
+    k[LEN - 1] &= ((Word) -1) >> 1;
+    assert(mon_mul_fixbase(r1, k, &noord) == MSPECC_NO_ERROR);
+    assert(mon_mul_fixbase(r2, k, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r1, r2, sizeof(r1)) == 0);
+  }
+  printf("fixed-base comb: ok\n");
+}
+
+#ifdef MSPECC_BENCH_CURVES
+void test_Curves() {
+  // for every (benchmark-only) curve of ecdparam.h available with the Word
+  // size, the comb (16-point table) must match the ladder with the base
+  // point u = [1]*G, and the ladder must commute, i.e. k0*(k1*G) = k1*(k0*G)
+  const ECDPARAM *crv[] = {
+#if (WSIZE != 64)
+    &CURVE_P159,
+#endif
+    &CURVE_P191,
+#if (WSIZE == 16)
+    &CURVE20791,
+#endif
+#if (WSIZE != 64)
+    &CURVE_P223,
+#endif
+    &CURVE_P255
+  };
+  enum { LEN = 256 / WSIZE };
+  Word k[2][LEN], u[LEN], p[2][LEN], r1[LEN], r2[LEN];
+  uint64_t s = 0x2545F4914F6CDD1DULL;
+
+  for (size_t c = 0; c < sizeof(crv) / sizeof(crv[0]); c++) {
+    int len = crv[c]->len;
+    int_set(k[0], 1, len);
+    assert(mon_mul_fixbase(u, k[0], crv[c]) == MSPECC_NO_ERROR);
+    assert(!int_is0(u, len));
+    for (int j = 0; j < 8; j++) {
+      for (int t = 0; t < 2; t++) {
+        for (int i = 0; i < len; i++) {
+          s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+          k[t][i] = (Word) s;
+        }
+        k[t][0] &= ~((Word) 7);
+        k[t][len - 1] &= ((Word) -1) >> 1;
+        k[t][len - 1] |= ((Word) 1) << (WSIZE - 2);
+        assert(mon_mul_fixbase(p[t], k[t], crv[c]) == MSPECC_NO_ERROR);
+        assert(mon_mul_varbase(r1, k[t], u, crv[c]) == MSPECC_NO_ERROR);
+        assert(memcmp(p[t], r1, len * sizeof(Word)) == 0);
+      }
+      assert(mon_mul_varbase(r1, k[0], p[1], crv[c]) == MSPECC_NO_ERROR);
+      assert(mon_mul_varbase(r2, k[1], p[0], crv[c]) == MSPECC_NO_ERROR);
+      assert(memcmp(r1, r2, len * sizeof(Word)) == 0);
+    }
+    printf("%d-bit curve (c = %u): ok\n", WSIZE * len - 1,
+           (unsigned) crv[c]->c);
+  }
+}
+#endif  // MSPECC_BENCH_CURVES
+
+void test_DblBase() {
+  // k1*G + k2*G (interleaved comb and sliding-window NAF) must match the
+  // fixed-base comb for k1 + k2 and the multi-scalar multiplication, k1 = 0
+  // must match the binary method for a random point P = a*G, and k2 = 0 the
+  // fixed-base comb for k1
+  enum { LEN = 256 / WSIZE };
+  Word k1[LEN], k2[LEN], k3[LEN], x[3 * LEN], y[3 * LEN], km[2 * LEN];
+  AFFPOINT g = { x, y }, p = { &x[LEN], &y[LEN] }, r = { &x[2 * LEN],
+                                                       &y[2 * LEN] };
+  DBLSCALAR k = { k1, k2 };
+  uint64_t s = 0xA4093822299F31D0ULL;
+
+  int_set(k1, 1, LEN);
+  assert(ted_mul_fixbase(&g, k1, &CURVE25519) == MSPECC_NO_ERROR);
+  for (int j = 0; j < 8; j++) {
+    for (int i = 0; i < LEN; i++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k1[i] = (Word) s;
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k2[i] = (Word) s;
+    }
+    k1[LEN - 1] &= ((Word) -1) >> 3;
+    k2[LEN - 1] &= ((Word) -1) >> 3;
+    int_add(k3, k1, k2, LEN);
+    assert(ted_mul_dblbase(&r, &k, &g, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(ted_mul_fixbase(&p, k3, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r.x, p.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(r.y, p.y, LEN * sizeof(Word)) == 0);
+    AFFPOINT gg[2] = { g, g };
+    int_copy(km, k1, LEN);
+    int_copy(&km[LEN], k2, LEN);
+    assert(ted_mul_multi(&r, km, gg, 2, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r.x, p.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(r.y, p.y, LEN * sizeof(Word)) == 0);
+
+    int_set(k1, 0, LEN);
+    assert(ted_mul_dblbase(&r, &k, &p, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(ted_mul_varbase(&g, k2, &p, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r.x, g.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(r.y, g.y, LEN * sizeof(Word)) == 0);
+
+    int_copy(k1, k3, LEN);
+    int_set(k2, 0, LEN);
+    assert(ted_mul_dblbase(&r, &k, &p, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(ted_mul_fixbase(&g, k1, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r.x, g.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(r.y, g.y, LEN * sizeof(Word)) == 0);
+
+    int_set(k1, 1, LEN);
+    assert(ted_mul_fixbase(&g, k1, &CURVE25519) == MSPECC_NO_ERROR);
+  }
+  printf("double-base scalar multiplication: ok\n");
+}
+
+void test_Msm() {
+  // the bucket method must match the interleaved method for 1, 2, 5, and 70
+  // points, with random scalars of full length and the scalars 0, 2^256 - 1,
+  // and 0x8080...80 (windows equal to 2^(c-1) propagate the carry)
+  enum { NUM = 70, LEN = 256 / WSIZE };
+  static Word k[NUM * LEN], x[(NUM + 2) * LEN], y[(NUM + 2) * LEN];
+  AFFPOINT p[NUM], r1 = { &x[NUM * LEN], &y[NUM * LEN] },
+                   r2 = { &x[(NUM + 1) * LEN], &y[(NUM + 1) * LEN] };
+  uint64_t s = 0x5851F42D4C957F2DULL;
+
+  for (int i = 0; i < NUM; i++) {
+    p[i].x = &x[i * LEN];
+    p[i].y = &y[i * LEN];
+    for (int j = 0; j < LEN; j++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k[i * LEN + j] = (Word) s;
+    }
+    k[i * LEN + LEN - 1] &= ((Word) -1) >> 3;
+    assert(ted_mul_fixbase(&p[i], &k[i * LEN], &CURVE25519) ==
+           MSPECC_NO_ERROR);
+    for (int j = 0; j < LEN; j++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k[i * LEN + j] = (Word) s;
+    }
+  }
+  int_set(&k[1 * LEN], 0, LEN);
+  int_set(&k[3 * LEN], (Word) -1, LEN);
+  for (int j = 0; j < LEN; j++) k[4 * LEN + j] = (Word) 0x8080808080808080ULL;
+
+  static const int num[4] = { 1, 2, 5, NUM };
+  for (int i = 0; i < 4; i++) {
+    assert(ted_msm(&r1, k, p, num[i], &CURVE25519) == MSPECC_NO_ERROR);
+    assert(ted_mul_multi(&r2, k, p, num[i], &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(r1.x, r2.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(r1.y, r2.y, LEN * sizeof(Word)) == 0);
+  }
+  printf("multi-scalar multiplication: ok\n");
+}
+
+void test_Compress() {
+  // gfp_pow22523 must match the binary method for (p-5)/8, decompression
+  // must invert compression for P and -P, and reject y = p as well as a y
+  // without x-coordinate (u/v not a square)
+  enum { LEN = 256 / WSIZE };
+  Word k[LEN], e[LEN], t1[LEN], t2[LEN], a[LEN], x[2 * LEN], y[2 * LEN];
+  AFFPOINT p = { x, y }, q = { &x[LEN], &y[LEN] };
+  uint64_t s = 0x2545F4914F6CDD1DULL;
+  int invalid = 0;
+
+  gfp_set(e, 19, LEN);
+  e[0] -= 5;
+  for (int i = 0; i < 3; i++) int_shr(e, e, LEN);
+  for (int j = 0; j < 8; j++) {
+    for (int i = 0; i < LEN; i++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      k[i] = (Word) s;
+    }
+    k[LEN - 1] &= ((Word) -1) >> 3;
+    gfp_pow22523(t1, k, 19, LEN);
+    gfp_pow(t2, k, e, 19, LEN);
+    assert(gfp_cmp(t1, t2, 19, LEN) == 0);
+
+    assert(ted_mul_fixbase(&p, k, &CURVE25519) == MSPECC_NO_ERROR);
+    ted_compress(a, &p, &CURVE25519);
+    assert(ted_decompress(&q, a, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(p.x, q.x, LEN * sizeof(Word)) == 0);
+    assert(memcmp(p.y, q.y, LEN * sizeof(Word)) == 0);
+    a[LEN - 1] ^= (Word) 1 << (WSIZE - 1);
+    assert(ted_decompress(&q, a, &CURVE25519) == MSPECC_NO_ERROR);
+    gfp_cneg(q.x, q.x, 19, 1, LEN);
+    assert(gfp_cmp(p.x, q.x, 19, LEN) == 0);
+    assert(memcmp(p.y, q.y, LEN * sizeof(Word)) == 0);
+  }
+
+  gfp_set(a, 19, LEN);
+  assert(ted_decompress(&q, a, &CURVE25519) == MSPECC_ERR_INVALID_POINT);
+  for (int i = 2; i < 10; i++) {
+    int_set(a, (Word) i, LEN);
+    invalid += (ted_decompress(&q, a, &CURVE25519) != MSPECC_NO_ERROR);
+  }
+  assert(invalid > 0);
+  printf("point compression: ok\n");
+}
+
+void test_Elligator() {
+  // every decoded u must have a representative that decodes to u again (not
+  // necessarily the original one, since u has one in both branches of the
+  // decoding), about half of all public keys must have a
+  // representative, and the keys of mon_mul_fixbase_elligator must decode
+  // to a u whose DH with a clamped scalar matches the one of k*G
+  enum { LEN = 256 / WSIZE };
+  Word k[LEN], k2[LEN], r[LEN], r2[LEN], u[LEN], u2[LEN], t[LEN];
+  uint64_t s = 0x9E3779B97F4A7C15ULL;
+  int invalid = 0;
+
+  for (int j = 0; j < 16; j++) {
+    for (int i = 0; i < LEN; i++) {
+      s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+      r[i] = (Word) s;
+      k[i] = (Word) (s * 0xD6E8FEB86659FD93ULL);
+      k2[i] = (Word) (s * 0xA0761D6478BD642FULL);
+    }
+    assert(mon_elligator_decode(u, r, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(mon_elligator_encode(r2, u, &CURVE25519) == MSPECC_NO_ERROR);
+    assert((r2[LEN - 1] >> (WSIZE - 2)) == 0);
+    assert(mon_elligator_decode(u2, r2, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(u, u2, sizeof(u)) == 0);
+
+    k[LEN - 1] &= ((Word) -1) >> 1;
+    k[LEN - 1] |= ((Word) 1) << (WSIZE - 2);
+    k[0] &= (Word) -8;
+    k2[LEN - 1] &= ((Word) -1) >> 1;
+    k2[LEN - 1] |= ((Word) 1) << (WSIZE - 2);
+    k2[0] &= (Word) -8;
+    assert(mon_mul_fixbase(u, k, &CURVE25519) == MSPECC_NO_ERROR);
+    invalid += (mon_elligator_encode(r, u, &CURVE25519) != MSPECC_NO_ERROR);
+
+    assert(mon_mul_fixbase_elligator(u, r, k, j * 37, &CURVE25519) ==
+           MSPECC_NO_ERROR);
+    assert((int) (r[LEN - 1] >> (WSIZE - 2)) == (((j * 37) >> 6) & 3));
+    assert(mon_elligator_decode(u2, r, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(u, u2, sizeof(u)) == 0);
+    assert((k[0] & 7) == 0);
+    assert(mon_mul_fixbase(u2, k, &CURVE25519) == MSPECC_NO_ERROR);
+    assert((memcmp(u, u2, sizeof(u)) == 0) == (((j * 37) & 7) == 0));
+    assert(mon_mul_varbase(t, k2, u, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(mon_mul_varbase(r2, k2, u2, &CURVE25519) == MSPECC_NO_ERROR);
+    assert(memcmp(t, r2, sizeof(t)) == 0);
+  }
+  assert((invalid > 0) && (invalid < 16));
+  printf("Elligator 2: ok\n");
+}
+
+void test_Ed25519() {
+  // SHA-512 of "abc" (FIPS 180-4) and of a 300-byte message absorbed in
+  // pieces, then the test vectors 1 to 3 of RFC 8032, Section 7.1: public
+  // key, deterministic signature, and verification, which must reject a
+  // modified message, a modified R, and an S that is not smaller than l
+  static const struct {
+    const char *sk, *pk, *msg;
+    size_t len;
+    const char *sig;
+  } vec[3] = {
+    { "\x9d\x61\xb1\x9d\xef\xfd\x5a\x60\xba\x84\x4a\xf4\x92\xec\x2c\xc4"
+      "\x44\x49\xc5\x69\x7b\x32\x69\x19\x70\x3b\xac\x03\x1c\xae\x7f\x60",
+      "\xd7\x5a\x98\x01\x82\xb1\x0a\xb7\xd5\x4b\xfe\xd3\xc9\x64\x07\x3a"
+      "\x0e\xe1\x72\xf3\xda\xa6\x23\x25\xaf\x02\x1a\x68\xf7\x07\x51\x1a",
+      "", 0,
+      "\xe5\x56\x43\x00\xc3\x60\xac\x72\x90\x86\xe2\xcc\x80\x6e\x82\x8a"
+      "\x84\x87\x7f\x1e\xb8\xe5\xd9\x74\xd8\x73\xe0\x65\x22\x49\x01\x55"
+      "\x5f\xb8\x82\x15\x90\xa3\x3b\xac\xc6\x1e\x39\x70\x1c\xf9\xb4\x6b"
+      "\xd2\x5b\xf5\xf0\x59\x5b\xbe\x24\x65\x51\x41\x43\x8e\x7a\x10\x0b" },
+    { "\x4c\xcd\x08\x9b\x28\xff\x96\xda\x9d\xb6\xc3\x46\xec\x11\x4e\x0f"
+      "\x5b\x8a\x31\x9f\x35\xab\xa6\x24\xda\x8c\xf6\xed\x4f\xb8\xa6\xfb",
+      "\x3d\x40\x17\xc3\xe8\x43\x89\x5a\x92\xb7\x0a\xa7\x4d\x1b\x7e\xbc"
+      "\x9c\x98\x2c\xcf\x2e\xc4\x96\x8c\xc0\xcd\x55\xf1\x2a\xf4\x66\x0c",
+      "\x72", 1,
+      "\x92\xa0\x09\xa9\xf0\xd4\xca\xb8\x72\x0e\x82\x0b\x5f\x64\x25\x40"
+      "\xa2\xb2\x7b\x54\x16\x50\x3f\x8f\xb3\x76\x22\x23\xeb\xdb\x69\xda"
+      "\x08\x5a\xc1\xe4\x3e\x15\x99\x6e\x45\x8f\x36\x13\xd0\xf1\x1d\x8c"
+      "\x38\x7b\x2e\xae\xb4\x30\x2a\xee\xb0\x0d\x29\x16\x12\xbb\x0c\x00" },
+    { "\xc5\xaa\x8d\xf4\x3f\x9f\x83\x7b\xed\xb7\x44\x2f\x31\xdc\xb7\xb1"
+      "\x66\xd3\x85\x35\x07\x6f\x09\x4b\x85\xce\x3a\x2e\x0b\x44\x58\xf7",
+      "\xfc\x51\xcd\x8e\x62\x18\xa1\xa3\x8d\xa4\x7e\xd0\x02\x30\xf0\x58"
+      "\x08\x16\xed\x13\xba\x33\x03\xac\x5d\xeb\x91\x15\x48\x90\x80\x25",
+      "\xaf\x82", 2,
+      "\x62\x91\xd6\x57\xde\xec\x24\x02\x48\x27\xe6\x9c\x3a\xbe\x01\xa3"
+      "\x0c\xe5\x48\xa2\x84\x74\x3a\x44\x5e\x36\x80\xd7\xdb\x5a\xc3\xac"
+      "\x18\xff\x9b\x53\x8d\x16\xf2\x90\xae\x67\xf7\x60\x98\x4d\xc6\x59"
+      "\x4a\x7c\x15\xe9\x71\x6e\xd2\x8d\xc0\x27\xbe\xce\xea\x1e\xc4\x0a" },
+  };
+  static const char *abc =
+      "\xdd\xaf\x35\xa1\x93\x61\x7a\xba\xcc\x41\x73\x49\xae\x20\x41\x31"
+      "\x12\xe6\xfa\x4e\x89\xa9\x7e\xa2\x0a\x9e\xee\xe6\x4b\x55\xd3\x9a"
+      "\x21\x92\x99\x2a\x27\x4f\xc1\xa8\x36\xba\x3c\x23\xa3\xfe\xeb\xbd"
+      "\x45\x4d\x44\x23\x64\x3c\xe8\x0e\x2a\x9a\xc9\x4f\xa5\x4c\xa4\x9f";
+  static const char *m300 =
+      "\xf1\xdc\xa2\xeb\x67\x7b\x30\x32\x65\xb0\xb9\xba\xff\x0e\x06\x12"
+      "\x02\x81\x8f\x35\xc1\x47\x0a\x69\xbb\xaa\x9b\xb6\x60\x25\xe9\x48"
+      "\xd9\x0e\x56\x5e\x69\x64\x25\x06\xc6\x21\x3a\xef\x3c\xf9\xe9\x29"
+      "\x35\x7a\x59\xda\x26\x3d\xeb\x34\xd1\x23\x6d\xbd\xcd\xa2\x79\xb3";
+  uint8_t h[SHA512_DIGEST_BYTES], msg[300], pk[32], sig[64];
+  sha512_s ctx;
+
+  sha512(h, (const uint8_t *) "abc", 3);
+  assert(memcmp(h, abc, 64) == 0);
+  for (int i = 0; i < 300; i++) msg[i] = (uint8_t) i;
+  sha512_init(&ctx);
+  sha512_update(&ctx, msg, 1);
+  sha512_update(&ctx, &msg[1], 130);
+  sha512_update(&ctx, &msg[131], 169);
+  sha512_final(&ctx, h);
+  assert(memcmp(h, m300, 64) == 0);
+
+  for (int i = 0; i < 3; i++) {
+    const uint8_t *sk = (const uint8_t *) vec[i].sk;
+    memcpy(msg, vec[i].msg, vec[i].len);
+    assert(ed25519_pubkey(pk, sk) == MSPECC_NO_ERROR);
+    assert(memcmp(pk, vec[i].pk, 32) == 0);
+    assert(ed25519_sign(sig, msg, vec[i].len, sk, pk) == MSPECC_NO_ERROR);
+    assert(memcmp(sig, vec[i].sig, 64) == 0);
+    assert(ed25519_verify(sig, msg, vec[i].len, pk) == MSPECC_NO_ERROR);
+    msg[vec[i].len] = 0;
+    assert(ed25519_verify(sig, msg, vec[i].len + 1, pk) ==
+           MSPECC_ERR_INVALID_SIGNATURE);
+    sig[0] ^= 1;
+    assert(ed25519_verify(sig, msg, vec[i].len, pk) ==
+           MSPECC_ERR_INVALID_SIGNATURE);
+    sig[0] ^= 1;
+    sig[63] |= 0x20;  // S >= 2^253 > l
+    assert(ed25519_verify(sig, msg, vec[i].len, pk) ==
+           MSPECC_ERR_INVALID_SIGNATURE);
+  }
+  printf("Ed25519 (RFC 8032): ok\n");
+}
+
+void test_Ed25519Batch() {
+  // 130 signatures (the bucket method for the whole group, the interleaved
+  // method for its halves) must pass and, after modifying the message of
+  // signature 5 and the S of signature 93, exactly these two must be located
+  // as invalid
+  enum { NUM = 130 };
+  uint8_t sk[32], pk[NUM][32], sig[NUM][64], msg[NUM][48];
+  const uint8_t *ps[NUM], *pm[NUM], *pp[NUM];
+  size_t len[NUM];
+  int valid[NUM];
+
+  for (int i = 0; i < NUM; i++) {
+    for (int j = 0; j < 32; j++) sk[j] = (uint8_t) (31 * i + 7 * j + 1);
+    for (int j = 0; j < 48; j++) msg[i][j] = (uint8_t) (i ^ (5 * j));
+    len[i] = (size_t) (i % 48);
+    assert(ed25519_pubkey(pk[i], sk) == MSPECC_NO_ERROR);
+    assert(ed25519_sign(sig[i], msg[i], len[i], sk, pk[i]) ==
+           MSPECC_NO_ERROR);
+    ps[i] = sig[i];
+    pm[i] = msg[i];
+    pp[i] = pk[i];
+  }
+  assert(ed25519_verify_batch(ps, pm, len, pp, NUM, valid) ==
+         MSPECC_NO_ERROR);
+  for (int i = 0; i < NUM; i++) assert(valid[i] == 1);
+
+  msg[5][0] ^= 1;
+  sig[93][40] ^= 1;
+  assert(ed25519_verify_batch(ps, pm, len, pp, NUM, NULL) ==
+         MSPECC_ERR_INVALID_SIGNATURE);
+  assert(ed25519_verify_batch(ps, pm, len, pp, NUM, valid) ==
+         MSPECC_ERR_INVALID_SIGNATURE);
+  for (int i = 0; i < NUM; i++) assert(valid[i] == ((i != 5) && (i != 93)));
+  printf("Ed25519 batch verification: ok\n");
+}
+
+void test_Ed25519Cofactor() {
+  // a signature with R = (sqrt(-1),0) of order 4 and S = k*a (nonce 0) only
+  // satisfies the cofactored equation; ed25519_verify and the batch
+  // verification must both accept it, also next to an invalid signature
+  enum { LEN = 256 / WSIZE };
+  const ECDPARAM *m = &CURVE25519;
+  uint8_t sk[32], h[SHA512_DIGEST_BYTES], pk[2][32], sig[2][64], msg[2][8];
+  const uint8_t *ps[2] = { sig[0], sig[1] }, *pm[2] = { msg[0], msg[1] };
+  const uint8_t *pp[2] = { pk[0], pk[1] };
+  size_t len[2] = { 8, 8 };
+  Word a[LEN], k[2 * LEN], s[LEN], x[LEN], y[LEN], t[LEN];
+  AFFPOINT r = { x, y };
+  sha512_s ctx;
+  int valid[2];
+
+  for (int j = 0; j < 32; j++) sk[j] = (uint8_t) (3 * j + 1);
+  for (int j = 0; j < 8; j++) msg[0][j] = msg[1][j] = (uint8_t) j;
+  assert(ed25519_pubkey(pk[1], sk) == MSPECC_NO_ERROR);
+  assert(ed25519_sign(sig[1], msg[1], 8, sk, pk[1]) == MSPECC_NO_ERROR);
+  sk[0] ^= 1;
+  assert(ed25519_pubkey(pk[0], sk) == MSPECC_NO_ERROR);
+
+  int_copy(x, m->rm1, LEN);
+  int_set(y, 0, LEN);
+  ted_compress(t, &r, m);
+  memcpy(sig[0], t, 32);
+  sha512(h, sk, 32);
+  h[0] &= 0xF8; h[31] &= 0x7F; h[31] |= 0x40;
+  memcpy(a, h, 32);
+  sha512_init(&ctx);
+  sha512_update(&ctx, sig[0], 32);
+  sha512_update(&ctx, pk[0], 32);
+  sha512_update(&ctx, msg[0], 8);
+  sha512_final(&ctx, h);
+  memcpy(k, h, 64);
+  scl_red(s, k, m);
+  scl_mul(s, s, a, m);
+  memcpy(&sig[0][32], s, 32);
+
+  assert(ed25519_verify(sig[0], msg[0], 8, pk[0]) == MSPECC_NO_ERROR);
+  assert(ed25519_verify_batch(ps, pm, len, pp, 2, valid) == MSPECC_NO_ERROR);
+  assert(valid[0] && valid[1]);
+  msg[1][0] ^= 1;
+  assert(ed25519_verify_batch(ps, pm, len, pp, 2, valid) ==
+         MSPECC_ERR_INVALID_SIGNATURE);
+  assert(valid[0] && !valid[1]);
+  msg[0][0] ^= 1;
+  assert(ed25519_verify(sig[0], msg[0], 8, pk[0]) ==
+         MSPECC_ERR_INVALID_SIGNATURE);
+  printf("Ed25519 cofactored verification: ok\n");
+}
+
+void test_MonVec() {
+  // multi-buffer ladders (4 + 8 results) must match the single one; result
+  // 2 has a scalar of 0, result 5 an x-coordinate with the MSB set, and
+  // result 9 a scalar with the MSB set (rejected by all ladders)
+  enum { NUM = 12, LEN = 256 / WSIZE };
+  Word k[NUM * LEN], x[NUM * LEN], r1[NUM * LEN], r2[LEN];
+  uint64_t s = 0xA4093822299F31D0ULL;
+
+  for (int i = 0; i < NUM * LEN; i++) {
+    s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+    k[i] = (Word) s;
+    s ^= s << 13; s ^= s >> 7; s ^= s << 17;
+    x[i] = (Word) s;
+  }
+  for (int i = 0; i < NUM; i++) {
+    k[i * LEN + LEN - 1] &= ((Word) -1) >> 1;
+    x[i * LEN + LEN - 1] &= ((Word) -1) >> 1;
+  }
+  x[5 * LEN + LEN - 1] |= ((Word) 1) << (WSIZE - 1);
+  k[9 * LEN + LEN - 1] |= ((Word) 1) << (WSIZE - 1);
+  int_set(&k[2 * LEN], 0, LEN);
+
+  assert(mon_mul_varbase_x4(r1, k, x, &CURVE25519) ==
+         MSPECC_ERR_INVALID_SCALAR);
+  assert(mon_mul_varbase_x8(&r1[4 * LEN], &k[4 * LEN], &x[4 * LEN],
+                            &CURVE25519) == MSPECC_ERR_INVALID_SCALAR);
+  assert(int_is0(&r1[9 * LEN], LEN));
+  for (int i = 0; i < NUM; i++) {
+    mon_mul_varbase(r2, &k[i * LEN], &x[i * LEN], &CURVE25519);
+    assert(memcmp(r2, &r1[i * LEN], sizeof(r2)) == 0);
+  }
+  printf("multi-buffer ladder (%d lanes): ok\n", MON_PAR_LANES);
+}
+
 void test_NK() {
   // generate server keypair
   keyPair server_keypair;
@@ -519,6 +1274,51 @@ int main() {
   //  test_Hash();
   // test_HashInteropGolang();
 
+  printf("\n\ntesting field inversion\n\n");
+  test_GfpInv();
+
+  printf("\n\ntesting fused field operations\n\n");
+  test_GfpMul32Add();
+  test_Karatsuba();
+
+  printf("\n\ntesting X25519\n\n");
+  test_X25519();
+
+  printf("\n\ntesting batched scalar multiplication\n\n");
+  test_MonBatch();
+  test_FixBase();
+
+#ifdef MSPECC_BENCH_CURVES
+  printf("\n\ntesting curves of ecdparam.h\n\n");
+  test_Curves();
+#endif
+
+  printf("\n\ntesting double-base scalar multiplication\n\n");
+  test_DblBase();
+
+  printf("\n\ntesting multi-scalar multiplication\n\n");
+  test_Msm();
+
+  printf("\n\ntesting point compression\n\n");
+  test_Compress();
+
+  printf("\n\ntesting Elligator 2\n\n");
+  test_Elligator();
+
+  printf("\n\ntesting Ed25519\n\n");
+  test_Ed25519();
+
+  printf("\n\ntesting Ed25519 batch verification\n\n");
+  test_Ed25519Batch();
+  test_Ed25519Cofactor();
+
+  printf("\n\ntesting multi-buffer ladder\n\n");
+  test_MonVec();
+
+  printf("\n\ntesting strobe batch\n\n");
+  test_Xoodoo();
+  test_StrobeBatch();
+
   printf("\n\ntesting NK\n\n");
   test_NK();
 
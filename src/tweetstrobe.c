@@ -29,31 +29,38 @@
 #define RATE (RATE_INNER - PAD_BYTES)
 
 /* Pull in a *Xoodoo* implementation.  Use the target-specific
- * asm one if available.
+ * asm one if available (see XOODOO_USE_ASM in xoodoo.h), and the
+ * portable C99 one otherwise.
  */
-// #include "xoodoo.c.inc"
-
-extern void xoodoo_perm_msp(uint16_t *state, uint16_t nr);
+#include "xoodoo.h"
 
 void Xoodoo_Permute_12rounds( kdomain_s * state)
 {
-  // Xoodoo_Permute_Nrounds( state, 12 );
-  xoodoo_perm_msp((uint16_t *) state, 12);
+  xoodoo_perm(state->b, 12);
 }
 
 
-static void _run_f(strobe_s *strobe, unsigned int pos) {
+/* Pad the state at the current position for a call of F; the
+ * permutation itself is left to the caller (see _run_f and
+ * strobe_operate_batch).
+ */
+static inline void _pad_f(strobe_s *strobe) {
+  unsigned int pos = strobe->position;
+
   strobe->state.b[pos] ^= strobe->pos_begin;
   strobe->pos_begin = 0;
   strobe->state.b[pos + 1] ^= 0x04;
   strobe->state.b[RATE + 1] ^= 0x80;
-  Xoodoo_Permute_12rounds(&strobe->state);
+  strobe->position = 0;
 }
 
-static inline void _begin_op(strobe_s *strobe, uint8_t flags) {
-  unsigned int pos = strobe->position;
+static void _run_f(strobe_s *strobe) {
+  _pad_f(strobe);
+  Xoodoo_Permute_12rounds(&strobe->state);
+}
 
-  // Adjust the direction based on transport
+// Adjust the direction based on transport
+static inline uint8_t _adjust_dir(strobe_s *strobe, uint8_t flags) {
   if (flags & FLAG_T) {
     if (strobe->initiator == 2) {  // None
       // Set who is initiator and who is responder
@@ -61,67 +68,135 @@ static inline void _begin_op(strobe_s *strobe, uint8_t flags) {
     }
     flags ^= strobe->initiator;
   }
+  return flags;
+}
+
+// Mark the state, returns true if F has to be run afterwards
+static inline bool _mark_begin(strobe_s *strobe) {
+  unsigned int pos = strobe->position;
 
-  // Mark the state
   strobe->state.b[pos] ^= strobe->pos_begin;
   pos++;
   strobe->pos_begin = pos;
-  if (pos >= RATE) {
-    _run_f(strobe, pos);
-    pos = 0;
-  }
+  strobe->position = pos;
+  return (pos >= RATE);
+}
+
+// Absorb the rest of the mode marker, returns true if F has to be run
+static inline bool _absorb_flags(strobe_s *strobe, uint8_t flags) {
+  unsigned int pos = strobe->position;
 
-  // Absorb the rest of the mode marker
   strobe->state.b[pos] ^= flags;
   pos++;
+  strobe->position = pos;
+  return (pos >= RATE || (flags & FLAG_C) != 0);
+}
 
-  if (pos >= RATE || (flags & FLAG_C) != 0) {
-    _run_f(strobe, pos);
-    pos = 0;
+static inline void _begin_op(strobe_s *strobe, uint8_t flags) {
+  flags = _adjust_dir(strobe, flags);
+  if (_mark_begin(strobe)) {
+    _run_f(strobe);
   }
+  if (_absorb_flags(strobe, flags)) {
+    _run_f(strobe);
+  }
+}
 
-  // Save the state position
-  strobe->position = pos;
+typedef uintptr_t duplex_word;
+#define WBYTES sizeof(duplex_word)
+
+/* Duplex the buffer up to the end of the current block of the state.
+ * Returns the number of bytes consumed; the new position is saved in
+ * the Strobe object and equals RATE when F has to be run. The three
+ * modes have their own loops, which process a machine word (uintptr_t)
+ * per iteration and only the remaining bytes one at a time; memcpy is
+ * used for the unaligned word accesses.
+ */
+static size_t _duplex_block(strobe_s *strobe, uint8_t *buffer,
+                            size_t buffer_len, bool cbefore, bool cafter,
+                            uint8_t *MAC_verif) {
+  // get our position in state
+  unsigned int pos = strobe->position;
+  uint8_t *state = strobe->state.b + pos;
+  size_t len = RATE - pos;
+  size_t i = 0;
+  duplex_word s, b, mac = 0;
+  uint8_t macb = 0;
+
+  if (len > buffer_len) len = buffer_len;
+  if (cafter) {
+    // state ^= buffer; buffer = state
+    for (; i + WBYTES <= len; i += WBYTES) {
+      memcpy(&s, state + i, WBYTES);
+      memcpy(&b, buffer + i, WBYTES);
+      s ^= b;
+      memcpy(state + i, &s, WBYTES);
+      memcpy(buffer + i, &s, WBYTES);
+      mac |= s;
+    }
+    for (; i < len; i++) {
+      state[i] ^= buffer[i];
+      buffer[i] = state[i];
+      macb |= buffer[i];
+    }
+  } else if (cbefore) {
+    // buffer ^= state; state ^= buffer (i.e. state = old buffer)
+    for (; i + WBYTES <= len; i += WBYTES) {
+      memcpy(&s, state + i, WBYTES);
+      memcpy(&b, buffer + i, WBYTES);
+      memcpy(state + i, &b, WBYTES);
+      b ^= s;
+      memcpy(buffer + i, &b, WBYTES);
+      mac |= b;
+    }
+    for (; i < len; i++) {
+      uint8_t t = buffer[i];
+      buffer[i] ^= state[i];
+      state[i] = t;
+      macb |= buffer[i];
+    }
+  } else {
+    // state ^= buffer
+    for (; i + WBYTES <= len; i += WBYTES) {
+      memcpy(&s, state + i, WBYTES);
+      memcpy(&b, buffer + i, WBYTES);
+      s ^= b;
+      memcpy(state + i, &s, WBYTES);
+      mac |= b;
+    }
+    for (; i < len; i++) {
+      state[i] ^= buffer[i];
+      macb |= buffer[i];
+    }
+  }
+
+  // recv_MAC
+  *MAC_verif |= macb | (uint8_t) (mac != 0);
+
+  // save state position
+  strobe->position = pos + len;
+  return len;
 }
 
 /* The core duplex mode */
 static bool _strobe_duplex(strobe_s *strobe, uint8_t *buffer, size_t buffer_len,
                            bool cbefore, bool cafter, bool recv_MAC) {
-  // get our position in state
-  unsigned int pos = strobe->position;
-
   // for recv_MAC
   uint8_t MAC_verif = 0;
 
   // consume the buffer
   size_t left = buffer_len;
   while (left > 0) {
-    // duplex magic
-    if (cbefore) {
-      *buffer ^= strobe->state.b[pos];
-    }
-    strobe->state.b[pos] ^= *buffer;
-    if (cafter) {
-      *buffer = strobe->state.b[pos];
-    }
-    // recv_MAC
-    if (recv_MAC) {
-      MAC_verif |= *buffer;
-    }
-    // advance
-    pos++;
-    buffer++;
-    left--;
+    size_t len = _duplex_block(strobe, buffer, left, cbefore, cafter,
+                               &MAC_verif);
+    buffer += len;
+    left -= len;
     // runF
-    if (pos >= RATE) {
-      _run_f(strobe, pos);
-      pos = 0;
+    if (strobe->position >= RATE) {
+      _run_f(strobe);
     }
   }
 
-  // save state position
-  strobe->position = pos;
-
   // recv_MAC
   if (recv_MAC) {
     if (MAC_verif == 0) {
@@ -135,15 +210,10 @@ static bool _strobe_duplex(strobe_s *strobe, uint8_t *buffer, size_t buffer_len,
   return true;
 }
 
-// strobe_operate
-// Note: if you're using PRF, RATCHET or send_MAC. Your buffer needs to be
-// initialized with 0s.
-bool strobe_operate(strobe_s *strobe, uint8_t flags, uint8_t *buffer,
-                    size_t buffer_len, bool more) {
-  assert(strobe->position < RATE);
-
-  // set buffer to 0 if RATCHET, send_MAC or PRF
-  // RATCHET = C, send_MAC = C | T, PRF = I | A | C
+// set buffer to 0 if RATCHET, send_MAC or PRF
+// RATCHET = C, send_MAC = C | T, PRF = I | A | C
+static inline void _clear_buffer(uint8_t flags, uint8_t *buffer,
+                                 size_t buffer_len) {
   if ((flags & FLAG_C) == FLAG_C) {
     if (flags == (FLAG_I | FLAG_A | FLAG_C) || flags == (FLAG_C) ||
         flags == (FLAG_C | FLAG_T)) {
@@ -152,6 +222,16 @@ bool strobe_operate(strobe_s *strobe, uint8_t flags, uint8_t *buffer,
       }
     }
   }
+}
+
+// strobe_operate
+// Note: if you're using PRF, RATCHET or send_MAC. Your buffer needs to be
+// initialized with 0s.
+bool strobe_operate(strobe_s *strobe, uint8_t flags, uint8_t *buffer,
+                    size_t buffer_len, bool more) {
+  assert(strobe->position < RATE);
+
+  _clear_buffer(flags, buffer, buffer_len);
 
   if (more) {
     assert(flags == strobe->flags);
@@ -167,6 +247,150 @@ bool strobe_operate(strobe_s *strobe, uint8_t flags, uint8_t *buffer,
   return _strobe_duplex(strobe, buffer, buffer_len, cbefore, cafter, recv_MAC);
 }
 
+//
+// Batched operation
+// =================
+// strobe_operate_batch() performs the same operation on a number of
+// independent Strobe objects (e.g. one per session of a server). Every
+// object is advanced until it needs a call of F, then the pending states
+// are permuted together by the multi-state Xoodoo (XOODOO_PAR_STATES at a
+// time), and so on until all buffers are consumed.
+
+// number of Strobe objects processed in one pass of strobe_operate_batch
+#define BATCH_SIZE 8
+
+// progress of one Strobe object within strobe_operate_batch
+typedef struct {
+  uint8_t *buffer;
+  size_t left;
+  uint8_t flags;      // flags with adjusted direction
+  uint8_t stage;      // 0: mark state, 1: absorb flags, 2: duplex, 3: done
+  uint8_t MAC_verif;  // for recv_MAC
+} batch_cursor;
+
+/* Advance a Strobe object until F has to be run (returns true; the
+ * state is padded already) or the operation is complete (false).
+ */
+static bool _batch_step(strobe_s *strobe, batch_cursor *cur, bool cbefore,
+                        bool cafter) {
+  switch (cur->stage) {
+    case 0:
+      cur->stage = 1;
+      if (_mark_begin(strobe)) {
+        _pad_f(strobe);
+        return true;
+      }
+      /* fall through */
+    case 1:
+      cur->stage = 2;
+      if (_absorb_flags(strobe, cur->flags)) {
+        _pad_f(strobe);
+        return true;
+      }
+      /* fall through */
+    case 2:
+      while (cur->left > 0) {
+        size_t len = _duplex_block(strobe, cur->buffer, cur->left, cbefore,
+                                   cafter, &cur->MAC_verif);
+        cur->buffer += len;
+        cur->left -= len;
+        if (strobe->position >= RATE) {
+          _pad_f(strobe);
+          return true;
+        }
+      }
+      cur->stage = 3;
+      /* fall through */
+    default:
+      return false;
+  }
+}
+
+/* Permute the states of 'num' Strobe objects, XOODOO_PAR_STATES at a
+ * time (unused slots of the last group are filled with a dummy state).
+ */
+static void _permute_batch(strobe_s *const strobes[], size_t num) {
+  uint8_t *states[8];
+  kdomain_s dummy;
+  size_t i, j;
+
+  memset(&dummy, 0, sizeof(dummy));
+  for (i = 0; i < num; i += XOODOO_PAR_STATES) {
+    if (num - i == 1 || XOODOO_PAR_STATES == 1) {
+      for (j = i; j < num && j < i + XOODOO_PAR_STATES; j++) {
+        Xoodoo_Permute_12rounds(&strobes[j]->state);
+      }
+      continue;
+    }
+    for (j = 0; j < XOODOO_PAR_STATES; j++) {
+      states[j] = (i + j < num) ? strobes[i + j]->state.b : dummy.b;
+    }
+#if XOODOO_PAR_STATES == 8
+    xoodoo_perm_x8(states, 12);
+#else
+    xoodoo_perm_x4(states, 12);
+#endif
+  }
+}
+
+// strobe_operate_batch
+// Same as strobe_operate with 'flags' and 'more' for all 'num' objects;
+// buffers[i] of length buffer_lens[i] belongs to strobes[i]. The result
+// of each operation is written to results[i] (if 'results' is not NULL),
+// the return value is true if all operations succeeded.
+bool strobe_operate_batch(strobe_s *const strobes[], uint8_t flags,
+                          uint8_t *const buffers[], const size_t buffer_lens[],
+                          size_t num, bool more, bool results[]) {
+  batch_cursor cur[BATCH_SIZE];
+  strobe_s *pending[BATCH_SIZE];
+  size_t base, i, np, cnt;
+  bool ok = true;
+
+  bool cafter = (flags & (FLAG_C | FLAG_I | FLAG_T)) == (FLAG_C | FLAG_T);
+  bool cbefore = (flags & FLAG_C) && (!cafter);
+  bool recv_MAC = (flags & (0xF | FLAG_I)) == (TYPE_MAC | FLAG_I);
+
+  for (base = 0; base < num; base += BATCH_SIZE) {
+    cnt = (num - base < BATCH_SIZE) ? (num - base) : BATCH_SIZE;
+
+    for (i = 0; i < cnt; i++) {
+      strobe_s *strobe = strobes[base + i];
+      assert(strobe->position < RATE);
+      _clear_buffer(flags, buffers[base + i], buffer_lens[base + i]);
+      cur[i].buffer = buffers[base + i];
+      cur[i].left = buffer_lens[base + i];
+      cur[i].MAC_verif = 0;
+      if (more) {
+        assert(flags == strobe->flags);
+        cur[i].flags = flags;
+        cur[i].stage = 2;
+      } else {
+        cur[i].flags = _adjust_dir(strobe, flags);
+        cur[i].stage = 0;
+        strobe->flags = flags;
+      }
+    }
+
+    // advance all objects to their next call of F and run F in parallel
+    do {
+      for (i = np = 0; i < cnt; i++) {
+        if (_batch_step(strobes[base + i], &cur[i], cbefore, cafter)) {
+          pending[np++] = strobes[base + i];
+        }
+      }
+      _permute_batch(pending, np);
+    } while (np > 0);
+
+    for (i = 0; i < cnt; i++) {
+      bool res = !recv_MAC || (cur[i].MAC_verif == 0);
+      if (results != NULL) results[base + i] = res;
+      ok = ok && res;
+    }
+  }
+
+  return ok;
+}
+
 void strobe_init(strobe_s *strobe, const char *protocol_name,
                  size_t protocol_name_len) {
   const uint8_t proto[18] = {
@@ -90,6 +90,12 @@ void strobe_init(strobe_s *strobe, const char *protocol_name, size_t desclen);
 bool strobe_operate(strobe_s *strobe, uint8_t control_flags, uint8_t *buffer,
                     size_t buffer_len, bool more);
 
+/* Operate on several independent Strobe objects (permutations run in
+ * parallel, see XOODOO_PAR_STATES in xoodoo.h) */
+bool strobe_operate_batch(strobe_s *const strobes[], uint8_t control_flags,
+                          uint8_t *const buffers[], const size_t buffer_lens[],
+                          size_t num, bool more, bool results[]);
+
 /* Flags as defined in the paper */
 #define FLAG_I (1 << 0) /**< Inbound */
 #define FLAG_A (1 << 1) /**< Has application-side data (eg, not a MAC) */
@@ -60,6 +60,9 @@ typedef struct ecparam {  // elliptic curve domain parameters
   const Word *rma;  // root of -a = -(A+2)/B (for point-conversion MON <-> TED)
   const Word *rm1;  // root of -1 (i.e., 2^((p-1)/4) mod p for decompression)
   const Word *tbl;  // table of pre-computed points for fixed-base comb method
+  const Word *ctb;  // configurable comb table (gen_param) or NULL
+  const Word *ord;  // order of the base point (prime subgroup) or NULL
+  const Word *omu;  // Barrett constant floor(2^(2*w*len)/ord) (len+1 words)
 } ECDPARAM;
 
 #endif
@@ -0,0 +1,297 @@
+/**
+ * @file xoodoo.c
+ * @brief Portable C99 implementation of the Xoodoo permutation.
+ *
+ * The 384-bit state is held in twelve 32-bit lanes a0...a11, where lane
+ * a(x+4*y) is lane x of plane y. All rounds are fully unrolled so that the
+ * twelve lanes can live in registers on 32/64-bit CPUs; the state is loaded
+ * and stored exactly once per call. Loads and stores are performed byte-wise
+ * in little-endian order, which means the result is identical to the one of
+ * the MSP430 Assembler implementation on hosts of any endianness (compilers
+ * turn these into plain 32-bit moves on little-endian targets).
+ */
+
+#include <stdint.h>
+#include "xoodoo.h"
+
+
+// rotation of a 32-bit lane to the left
+#define ROTL32(x, n) ((uint32_t) (((x) << (n)) | ((x) >> (32 - (n)))))
+
+
+/*------Load a 32-bit lane in little-endian byte order------*/
+static inline uint32_t load32le(const uint8_t *p)
+{
+  return ((uint32_t) p[0]) | (((uint32_t) p[1]) << 8) |
+         (((uint32_t) p[2]) << 16) | (((uint32_t) p[3]) << 24);
+}
+
+
+/*------Store a 32-bit lane in little-endian byte order------*/
+static inline void store32le(uint8_t *p, uint32_t x)
+{
+  p[0] = (uint8_t) x;
+  p[1] = (uint8_t) (x >> 8);
+  p[2] = (uint8_t) (x >> 16);
+  p[3] = (uint8_t) (x >> 24);
+}
+
+
+// one round of Xoodoo: theta, rho-west, iota, chi, and rho-east, whereby the
+// plane shifts of rho-west and rho-east are realized by renaming the lanes
+#define XOODOO_ROUND(rc) do {                                                 \
+  /* theta: column parity P, effect E = P<<<(1,5) ^ P<<<(1,14) */             \
+  p0 = a0 ^ a4 ^ a8; p1 = a1 ^ a5 ^ a9;                                       \
+  p2 = a2 ^ a6 ^ a10; p3 = a3 ^ a7 ^ a11;                                     \
+  e0 = ROTL32(p3, 5) ^ ROTL32(p3, 14);                                        \
+  e1 = ROTL32(p0, 5) ^ ROTL32(p0, 14);                                        \
+  e2 = ROTL32(p1, 5) ^ ROTL32(p1, 14);                                        \
+  e3 = ROTL32(p2, 5) ^ ROTL32(p2, 14);                                        \
+  a0 ^= e0; a4 ^= e0; a8 ^= e0;                                               \
+  a1 ^= e1; a5 ^= e1; a9 ^= e1;                                               \
+  a2 ^= e2; a6 ^= e2; a10 ^= e2;                                              \
+  a3 ^= e3; a7 ^= e3; a11 ^= e3;                                              \
+  /* rho-west: A1 = A1<<<(1,0), A2 = A2<<<(0,11) */                           \
+  t0 = a7; a7 = a6; a6 = a5; a5 = a4; a4 = t0;                                \
+  a8 = ROTL32(a8, 11); a9 = ROTL32(a9, 11);                                   \
+  a10 = ROTL32(a10, 11); a11 = ROTL32(a11, 11);                               \
+  /* iota */                                                                  \
+  a0 ^= (rc);                                                                 \
+  /* chi: Ay ^= ~A(y+1) & A(y+2) */                                           \
+  t0 = ~a4 & a8; t1 = ~a8 & a0; t2 = ~a0 & a4;                                \
+  a0 ^= t0; a4 ^= t1; a8 ^= t2;                                               \
+  t0 = ~a5 & a9; t1 = ~a9 & a1; t2 = ~a1 & a5;                                \
+  a1 ^= t0; a5 ^= t1; a9 ^= t2;                                               \
+  t0 = ~a6 & a10; t1 = ~a10 & a2; t2 = ~a2 & a6;                              \
+  a2 ^= t0; a6 ^= t1; a10 ^= t2;                                              \
+  t0 = ~a7 & a11; t1 = ~a11 & a3; t2 = ~a3 & a7;                              \
+  a3 ^= t0; a7 ^= t1; a11 ^= t2;                                              \
+  /* rho-east: A1 = A1<<<(0,1), A2 = A2<<<(2,8) */                            \
+  a4 = ROTL32(a4, 1); a5 = ROTL32(a5, 1);                                     \
+  a6 = ROTL32(a6, 1); a7 = ROTL32(a7, 1);                                     \
+  t0 = ROTL32(a8, 8); t1 = ROTL32(a9, 8);                                     \
+  a8 = ROTL32(a10, 8); a9 = ROTL32(a11, 8); a10 = t0; a11 = t1;               \
+} while (0)
+
+
+/*------Xoodoo permutation with 'nr' rounds (1 <= nr <= 12)------*/
+void xoodoo_perm_c99(uint8_t *state, unsigned int nr)
+{
+  uint32_t a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11;
+  uint32_t p0, p1, p2, p3, e0, e1, e2, e3, t0, t1, t2;
+
+  a0 = load32le(state);      a1 = load32le(state + 4);
+  a2 = load32le(state + 8);  a3 = load32le(state + 12);
+  a4 = load32le(state + 16); a5 = load32le(state + 20);
+  a6 = load32le(state + 24); a7 = load32le(state + 28);
+  a8 = load32le(state + 32); a9 = load32le(state + 36);
+  a10 = load32le(state + 40); a11 = load32le(state + 44);
+
+  // the last 'nr' round constants are used, i.e. a permutation with less than
+  // 12 rounds enters the unrolled sequence in the middle (falls through)
+  switch (nr) {
+    default:
+    case 12: XOODOO_ROUND(0x00000058);
+    /* fall through */
+    case 11: XOODOO_ROUND(0x00000038);
+    /* fall through */
+    case 10: XOODOO_ROUND(0x000003C0);
+    /* fall through */
+    case 9:  XOODOO_ROUND(0x000000D0);
+    /* fall through */
+    case 8:  XOODOO_ROUND(0x00000120);
+    /* fall through */
+    case 7:  XOODOO_ROUND(0x00000014);
+    /* fall through */
+    case 6:  XOODOO_ROUND(0x00000060);
+    /* fall through */
+    case 5:  XOODOO_ROUND(0x0000002C);
+    /* fall through */
+    case 4:  XOODOO_ROUND(0x00000380);
+    /* fall through */
+    case 3:  XOODOO_ROUND(0x000000F0);
+    /* fall through */
+    case 2:  XOODOO_ROUND(0x000001A0);
+    /* fall through */
+    case 1:  XOODOO_ROUND(0x00000012);
+    /* fall through */
+    case 0:  break;
+  }
+
+  store32le(state, a0);      store32le(state + 4, a1);
+  store32le(state + 8, a2);  store32le(state + 12, a3);
+  store32le(state + 16, a4); store32le(state + 20, a5);
+  store32le(state + 24, a6); store32le(state + 28, a7);
+  store32le(state + 32, a8); store32le(state + 36, a9);
+  store32le(state + 40, a10); store32le(state + 44, a11);
+}
+
+
+#if defined(__SSE2__) || defined(__AVX2__)
+
+// round constants of Xoodoo; a permutation with 'nr' rounds uses the last 'nr'
+// of them (needed by the multi-state implementations, which are not unrolled)
+static const uint32_t XOODOO_RC[XOODOO_MAX_ROUNDS] = {
+  0x00000058, 0x00000038, 0x000003C0, 0x000000D0, 0x00000120, 0x00000014,
+  0x00000060, 0x0000002C, 0x00000380, 0x000000F0, 0x000001A0, 0x00000012 };
+
+
+// One round of Xoodoo on an array a[12] of vectors, each holding the same lane
+// of several states (transposed layout). XOR, ANDN (~x & y) and ROTL are the
+// vector operations of the instruction set, RC is a broadcast round constant.
+#define XOODOO_ROUND_V(XOR, ANDN, ROTL, RC) do {                              \
+  p[0] = XOR(XOR(a[0], a[4]), a[8]); p[1] = XOR(XOR(a[1], a[5]), a[9]);       \
+  p[2] = XOR(XOR(a[2], a[6]), a[10]); p[3] = XOR(XOR(a[3], a[7]), a[11]);     \
+  for (x = 0; x < 4; x++) {                                                   \
+    e = XOR(ROTL(p[(x+3)&3], 5), ROTL(p[(x+3)&3], 14));                       \
+    a[x] = XOR(a[x], e); a[x+4] = XOR(a[x+4], e); a[x+8] = XOR(a[x+8], e);    \
+  }                                                                           \
+  t[0] = a[7]; a[7] = a[6]; a[6] = a[5]; a[5] = a[4]; a[4] = t[0];            \
+  for (x = 8; x < 12; x++) a[x] = ROTL(a[x], 11);                             \
+  a[0] = XOR(a[0], (RC));                                                     \
+  for (x = 0; x < 4; x++) {                                                   \
+    t[0] = ANDN(a[x+4], a[x+8]);                                              \
+    t[1] = ANDN(a[x+8], a[x]);                                                \
+    t[2] = ANDN(a[x], a[x+4]);                                                \
+    a[x] = XOR(a[x], t[0]); a[x+4] = XOR(a[x+4], t[1]);                       \
+    a[x+8] = XOR(a[x+8], t[2]);                                               \
+  }                                                                           \
+  for (x = 4; x < 8; x++) a[x] = ROTL(a[x], 1);                               \
+  t[0] = ROTL(a[8], 8); t[1] = ROTL(a[9], 8);                                 \
+  a[8] = ROTL(a[10], 8); a[9] = ROTL(a[11], 8); a[10] = t[0]; a[11] = t[1];   \
+} while (0)
+
+#endif  // __SSE2__ || __AVX2__
+
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+#define V4_XOR(x, y)  _mm_xor_si128((x), (y))
+#define V4_ANDN(x, y) _mm_andnot_si128((x), (y))
+#define V4_ROTL(x, n) _mm_or_si128(_mm_slli_epi32((x), (n)), \
+                                   _mm_srli_epi32((x), 32 - (n)))
+
+// 4x4 transposition of 32-bit elements (its own inverse)
+#define V4_TRANSPOSE(r0, r1, r2, r3) do {                                     \
+  __m128i u0 = _mm_unpacklo_epi32((r0), (r1));                                \
+  __m128i u1 = _mm_unpacklo_epi32((r2), (r3));                                \
+  __m128i u2 = _mm_unpackhi_epi32((r0), (r1));                                \
+  __m128i u3 = _mm_unpackhi_epi32((r2), (r3));                                \
+  (r0) = _mm_unpacklo_epi64(u0, u1); (r1) = _mm_unpackhi_epi64(u0, u1);       \
+  (r2) = _mm_unpacklo_epi64(u2, u3); (r3) = _mm_unpackhi_epi64(u2, u3);       \
+} while (0)
+
+
+/*------Xoodoo permutation of four states (SSE2, transposed lanes)------*/
+void xoodoo_perm_x4(uint8_t *const states[4], unsigned int nr)
+{
+  __m128i a[12], p[4], t[3], e;
+  unsigned int i, x;
+  
+  if (nr > XOODOO_MAX_ROUNDS) nr = XOODOO_MAX_ROUNDS;
+  
+  // a[j] holds lane j of states[0], ..., states[3]
+  for (i = 0; i < 12; i += 4) {
+    a[i]   = _mm_loadu_si128((const __m128i *) (states[0] + 4*i));
+    a[i+1] = _mm_loadu_si128((const __m128i *) (states[1] + 4*i));
+    a[i+2] = _mm_loadu_si128((const __m128i *) (states[2] + 4*i));
+    a[i+3] = _mm_loadu_si128((const __m128i *) (states[3] + 4*i));
+    V4_TRANSPOSE(a[i], a[i+1], a[i+2], a[i+3]);
+  }
+  
+  for (i = XOODOO_MAX_ROUNDS - nr; i < XOODOO_MAX_ROUNDS; i++) {
+    XOODOO_ROUND_V(V4_XOR, V4_ANDN, V4_ROTL, _mm_set1_epi32(XOODOO_RC[i]));
+  }
+  
+  for (i = 0; i < 12; i += 4) {
+    V4_TRANSPOSE(a[i], a[i+1], a[i+2], a[i+3]);
+    _mm_storeu_si128((__m128i *) (states[0] + 4*i), a[i]);
+    _mm_storeu_si128((__m128i *) (states[1] + 4*i), a[i+1]);
+    _mm_storeu_si128((__m128i *) (states[2] + 4*i), a[i+2]);
+    _mm_storeu_si128((__m128i *) (states[3] + 4*i), a[i+3]);
+  }
+}
+
+#else  // no SIMD: permute the four states one after the other
+
+void xoodoo_perm_x4(uint8_t *const states[4], unsigned int nr)
+{
+  int i;
+  
+  for (i = 0; i < 4; i++) xoodoo_perm_c99(states[i], nr);
+}
+
+#endif  // __SSE2__
+
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define V8_XOR(x, y)  _mm256_xor_si256((x), (y))
+#define V8_ANDN(x, y) _mm256_andnot_si256((x), (y))
+#define V8_ROTL(x, n) _mm256_or_si256(_mm256_slli_epi32((x), (n)), \
+                                      _mm256_srli_epi32((x), 32 - (n)))
+
+// two 4x4 transpositions of 32-bit elements, one per 128-bit half
+#define V8_TRANSPOSE(r0, r1, r2, r3) do {                                     \
+  __m256i u0 = _mm256_unpacklo_epi32((r0), (r1));                             \
+  __m256i u1 = _mm256_unpacklo_epi32((r2), (r3));                             \
+  __m256i u2 = _mm256_unpackhi_epi32((r0), (r1));                             \
+  __m256i u3 = _mm256_unpackhi_epi32((r2), (r3));                             \
+  (r0) = _mm256_unpacklo_epi64(u0, u1); (r1) = _mm256_unpackhi_epi64(u0, u1); \
+  (r2) = _mm256_unpacklo_epi64(u2, u3); (r3) = _mm256_unpackhi_epi64(u2, u3); \
+} while (0)
+
+// load 16 bytes of states[k] into the low and of states[k+4] into the high half
+#define V8_LOAD2(k, off) _mm256_inserti128_si256(_mm256_castsi128_si256(     \
+  _mm_loadu_si128((const __m128i *) (states[k] + (off)))),                    \
+  _mm_loadu_si128((const __m128i *) (states[(k)+4] + (off))), 1)
+
+#define V8_STORE2(k, off, v) do {                                             \
+  _mm_storeu_si128((__m128i *) (states[k] + (off)),                           \
+                   _mm256_castsi256_si128(v));                                \
+  _mm_storeu_si128((__m128i *) (states[(k)+4] + (off)),                       \
+                   _mm256_extracti128_si256((v), 1));                         \
+} while (0)
+
+
+/*------Xoodoo permutation of eight states (AVX2, transposed lanes)------*/
+void xoodoo_perm_x8(uint8_t *const states[8], unsigned int nr)
+{
+  __m256i a[12], p[4], t[3], e;
+  unsigned int i, x;
+  
+  if (nr > XOODOO_MAX_ROUNDS) nr = XOODOO_MAX_ROUNDS;
+  
+  // a[j] holds lane j of states[0], ..., states[7]
+  for (i = 0; i < 12; i += 4) {
+    a[i]   = V8_LOAD2(0, 4*i);
+    a[i+1] = V8_LOAD2(1, 4*i);
+    a[i+2] = V8_LOAD2(2, 4*i);
+    a[i+3] = V8_LOAD2(3, 4*i);
+    V8_TRANSPOSE(a[i], a[i+1], a[i+2], a[i+3]);
+  }
+  
+  for (i = XOODOO_MAX_ROUNDS - nr; i < XOODOO_MAX_ROUNDS; i++) {
+    XOODOO_ROUND_V(V8_XOR, V8_ANDN, V8_ROTL, _mm256_set1_epi32(XOODOO_RC[i]));
+  }
+  
+  for (i = 0; i < 12; i += 4) {
+    V8_TRANSPOSE(a[i], a[i+1], a[i+2], a[i+3]);
+    V8_STORE2(0, 4*i, a[i]);
+    V8_STORE2(1, 4*i, a[i+1]);
+    V8_STORE2(2, 4*i, a[i+2]);
+    V8_STORE2(3, 4*i, a[i+3]);
+  }
+}
+
+#else  // no AVX2: permute the eight states as two groups of four
+
+void xoodoo_perm_x8(uint8_t *const states[8], unsigned int nr)
+{
+  xoodoo_perm_x4(states, nr);
+  xoodoo_perm_x4(states + 4, nr);
+}
+
+#endif  // __AVX2__
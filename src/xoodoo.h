@@ -0,0 +1,54 @@
+/**
+ * @file xoodoo.h
+ * @brief Xoodoo permutation used by the Strobe duplex construction.
+ *
+ * Two implementations of the permutation exist: the MSP430 Assembler one in
+ * mspasm/xoodoo_perm_msp.s43 and a portable C99 one in xoodoo.c. Both operate
+ * on the 48-byte Xoodoo state in little-endian byte order, i.e. the state can
+ * be passed as the byte array of a kdomain_s union on any target.
+ */
+#ifndef _XOODOO_H
+#define _XOODOO_H
+
+#include <stdint.h>
+
+// define XOODOO_USE_ASM to use the MSP430 Assembler implementation of the
+// Xoodoo permutation, undefine it to use the portable C99 implementation. The
+// Assembler file uses IAR syntax and is therefore only selected by default
+// when compiling with the IAR C/C++ Compiler for MSP430.
+#if defined(__ICC430__) && !defined(XOODOO_NO_ASM)
+#define XOODOO_USE_ASM
+#endif
+
+/* number of bytes of the Xoodoo state */
+#define XOODOO_STATE_BYTES 48
+
+/* maximum number of rounds of the Xoodoo permutation */
+#define XOODOO_MAX_ROUNDS 12
+
+/* number of states the target permutes in parallel (i.e. the width of the */
+/* widest multi-state implementation available on the target)              */
+#if defined(__AVX2__)
+#define XOODOO_PAR_STATES 8
+#elif defined(__SSE2__)
+#define XOODOO_PAR_STATES 4
+#else
+#define XOODOO_PAR_STATES 1
+#endif
+
+/* prototypes of multi-state functions (SSE2 and AVX2 implementations with  */
+/* a transposed lane layout, or a loop over the single-state permutation)   */
+void xoodoo_perm_x4(uint8_t *const states[4], unsigned int nr);
+void xoodoo_perm_x8(uint8_t *const states[8], unsigned int nr);
+
+/* prototypes of functions for which both C and ASM implementations exist */
+void xoodoo_perm_c99(uint8_t *state, unsigned int nr);
+extern void xoodoo_perm_msp(uint16_t *state, uint16_t nr);
+
+#ifdef XOODOO_USE_ASM
+#define xoodoo_perm(s, nr) xoodoo_perm_msp((uint16_t *) (s), (nr))
+#else
+#define xoodoo_perm(s, nr) xoodoo_perm_c99((uint8_t *) (s), (nr))
+#endif  // XOODOO_USE_ASM
+
+#endif  // _XOODOO_H